@@ -22,7 +22,11 @@
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/aviation/liverylist.h"
 #include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/geo/coordinategeodeticgrid.h"
+#include "blackmisc/geo/coordinategeodeticlist.h"
+#include "blackmisc/geo/greatcirclekernel.h"
 #include "blackmisc/math/mathutils.h"
+#include "blackmisc/memotable.h"
 #include "blackmisc/pq/units.h"
 #include "blackmisc/test/testing.h"
 #include "blackmisc/swiftdirectories.h"
@@ -32,6 +36,7 @@
 #include <QDateTime>
 #include <QHash>
 #include <QList>
+#include <QMap>
 #include <QRegExp>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
@@ -43,6 +48,7 @@
 #include <QVector>
 #include <Qt>
 #include <algorithm>
+#include <array>
 #include <iterator>
 
 using namespace BlackMisc;
@@ -330,6 +336,16 @@ namespace BlackSample
         ms = timer.elapsed();
         out << "Read via DB JSON format (new): " << dbModels2.size() << " models in " << ms << "ms" << Qt::endl;
 
+        // as the readers do: UTF-8 reply, prebuilt ICAO codes and liveries, progress per chunk
+        const QByteArray modelUtf8 = modelData.toUtf8();
+        int progressCalls = 0;
+        timer.start();
+        CDatabaseReader::stringToDatastoreResponse(modelUtf8, response);
+        const CAircraftModelList dbModels3 = CAircraftModelList::fromDatabaseJsonCaching(response, dbModels.getAircraftIcaoCodesFromDb(), {}, dbLiveries, {}, [&](int) { progressCalls++; });
+        ms = timer.elapsed();
+        out << "Parsed UTF-8 and read via DB JSON format (prebuilt): " << dbModels3.size() << " models in " << ms << "ms, progress " << progressCalls << "x" << Qt::endl;
+        Q_ASSERT_X(dbModels3.size() == dbModels2.size(), Q_FUNC_INFO, "Mismatching container size");
+
         // swift JSON format
         const QJsonObject swiftJsonObject = dbModels.toJson();
         out << "Converted to swift JSON" << Qt::endl;
@@ -341,6 +357,45 @@ namespace BlackSample
         out << "Read via swift JSON format: " << swiftModels.size() << " models in " << ms << "ms" << Qt::endl;
 
         Q_ASSERT_X(swiftModels.size() == dbModels.size(), Q_FUNC_INFO, "Mismatching container size");
+
+        // memoization, ordered lookups as formerly used by CMemoTable versus the hashed CMemoTable
+        CDictionary<CAircraftIcaoCode, int, QMap> orderedIcaos;
+        CDictionary<CLivery, int, QMap> orderedLiveries;
+        CDictionary<CDistributor, int, QMap> orderedDistributors;
+        timer.start();
+        for (const CAircraftModel &model : dbModels)
+        {
+            orderedIcaos[model.getAircraftIcaoCode()] = 1;
+            orderedLiveries[model.getLivery()] = 1;
+            orderedDistributors[model.getDistributor()] = 1;
+        }
+        ms = timer.elapsed();
+        out << "Memoize " << dbModels.size() << " models (ordered): " << ms << "ms" << Qt::endl;
+
+        CAircraftModel::MemoHelper::CMemoizer memoizer;
+        timer.start();
+        for (const CAircraftModel &model : dbModels)
+        {
+            memoizer.maybeMemoize(model.getAircraftIcaoCode());
+            memoizer.maybeMemoize(model.getLivery());
+            memoizer.maybeMemoize(model.getDistributor());
+        }
+        ms = timer.elapsed();
+        out << "Memoize " << dbModels.size() << " models (hashed): " << ms << "ms, " << memoizer.getTable<CLivery>().size() << " liveries" << Qt::endl;
+
+        // memoized JSON as written to the caches, parallel for large lists
+        timer.start();
+        const QJsonObject memoizedJson = dbModels.toMemoizedJson();
+        ms = timer.elapsed();
+        out << "Convert " << dbModels.size() << " models to memoized JSON: " << ms << "ms" << Qt::endl;
+
+        CAircraftModelList memoizedModels;
+        timer.start();
+        memoizedModels.convertFromMemoizedJson(memoizedJson);
+        ms = timer.elapsed();
+        out << "Read " << memoizedModels.size() << " models from memoized JSON: " << ms << "ms" << Qt::endl;
+
+        Q_ASSERT_X(memoizedModels == dbModels, Q_FUNC_INFO, "Mismatching memoized models");
         return EXIT_SUCCESS;
     }
 
@@ -668,6 +723,105 @@ namespace BlackSample
         return EXIT_SUCCESS;
     }
 
+    int CSamplesPerformance::samplesElevationGridVsList(QTextStream &out)
+    {
+        // remembered elevations at a crowded airport, as in ISimulationEnvironmentProvider
+        for (int number : { 100, 500, 2000 })
+        {
+            CCoordinateGeodeticList list;
+            CCoordinateGeodeticGrid grid;
+            for (int i = 0; i < number; ++i)
+            {
+                const CCoordinateGeodetic c(50.03 + CMathUtils::randomDouble(0.1) - 0.05, 8.57 + CMathUtils::randomDouble(0.1) - 0.05, 364.0);
+                list.push_front(c);
+                grid.insert(c);
+            }
+
+            // aircraft requesting elevations
+            QList<CCoordinateGeodetic> references;
+            for (int i = 0; i < 1000; ++i)
+            {
+                references.push_back(CCoordinateGeodetic(50.03 + CMathUtils::randomDouble(0.1) - 0.05, 8.57 + CMathUtils::randomDouble(0.1) - 0.05, 0.0));
+            }
+
+            const CLength range(200.0, CLengthUnit::m());
+            int found = 0;
+            QElapsedTimer time;
+            time.start();
+            for (const CCoordinateGeodetic &reference : std::as_const(references))
+            {
+                if (!list.findClosestWithinRange(reference, range).isNull()) { found++; }
+                if (!list.findFirstWithinRangeOrDefault(reference, CElevationPlane::singlePointRadius()).isNull()) { found++; }
+                if (list.findWithinRange(reference, range).size() > 2) { found++; }
+            }
+            out << "list " << number << " elevations, 1000 aircraft: " << time.elapsed() << "ms found " << found << Qt::endl;
+
+            found = 0;
+            time.start();
+            for (const CCoordinateGeodetic &reference : std::as_const(references))
+            {
+                if (!grid.findClosestWithinRange(reference, range).isNull()) { found++; }
+                if (!grid.findFirstWithinRangeOrDefault(reference, CElevationPlane::singlePointRadius()).isNull()) { found++; }
+                if (grid.findWithinRange(reference, range).size() > 2) { found++; }
+            }
+            out << "grid " << number << " elevations, 1000 aircraft: " << time.elapsed() << "ms found " << found << Qt::endl;
+
+            time.start();
+            for (int i = 0; i < 100; ++i) { CCoordinateGeodeticList l(list); l.sortByEuclideanDistanceSquared(references[i]); l.truncate(number / 2); }
+            out << "list " << number << " elevations, 100x keep closest half: " << time.elapsed() << "ms" << Qt::endl;
+
+            time.start();
+            for (int i = 0; i < 100; ++i) { CCoordinateGeodeticGrid g(grid); g.keepClosest(number / 2, references[i]); }
+            out << "grid " << number << " elevations, 100x keep closest half: " << time.elapsed() << "ms" << Qt::endl;
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesGreatCircleKernel(QTextStream &out)
+    {
+        out << "kernel: " << greatCircleKernelInstructionSet() << Qt::endl;
+        const CCoordinateGeodetic ownPosition(50.03, 8.57, 0.0);
+        for (int number : { 50, 500, 5000 })
+        {
+            // ATC stations / aircraft around the own position
+            CAtcStationList stations;
+            QVector<std::array<double, 3>> vectors;
+            for (int i = 0; i < number; ++i)
+            {
+                CAtcStation station;
+                station.setPosition(CCoordinateGeodetic(50.03 + CMathUtils::randomDouble(10.0) - 5.0, 8.57 + CMathUtils::randomDouble(10.0) - 5.0, 0.0));
+                stations.push_back(station);
+                vectors.push_back(station.normalVectorDouble());
+            }
+            QVector<double> distances(number);
+            QVector<double> bearings(number);
+            const int repeat = 500000 / number;
+
+            QElapsedTimer time;
+            time.start();
+            for (int r = 0; r < repeat; ++r)
+            {
+                for (CAtcStation &station : stations) { station.calculcateAndUpdateRelativeDistanceAndBearing(ownPosition); }
+            }
+            out << number << " stations, " << repeat << "x one by one: " << time.elapsed() << "ms" << Qt::endl;
+
+            time.start();
+            for (int r = 0; r < repeat; ++r) { stations.calculcateAndUpdateRelativeDistanceAndBearing(ownPosition); }
+            out << number << " stations, " << repeat << "x list batch: " << time.elapsed() << "ms" << Qt::endl;
+
+            time.start();
+            for (int r = 0; r < repeat; ++r) { calculateGreatCircleDistancesAndBearingsScalar(ownPosition.normalVectorDouble(), vectors.constData(), number, distances.data(), bearings.data()); }
+            out << number << " vectors, " << repeat << "x kernel scalar: " << time.elapsed() << "ms" << Qt::endl;
+
+            time.start();
+            for (int r = 0; r < repeat; ++r) { calculateGreatCircleDistancesAndBearings(ownPosition.normalVectorDouble(), vectors.constData(), number, distances.data(), bearings.data()); }
+            out << number << " vectors, " << repeat << "x kernel: " << time.elapsed() << "ms" << Qt::endl;
+        }
+
+        return EXIT_SUCCESS;
+    }
+
     CAircraftSituationList CSamplesPerformance::createSituations(qint64 baseTimeEpoch, int numberOfCallsigns, int numberOfTimes)
     {
         CAircraftSituationList situations;
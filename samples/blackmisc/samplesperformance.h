@@ -53,6 +53,12 @@ namespace BlackSample
         //! Callsign based hash/map comparison
         static int sampleQMapVsQHashByCallsign(QTextStream &out);
 
+        //! Elevation cache, grid vs. list
+        static int samplesElevationGridVsList(QTextStream &out);
+
+        //! Distances and bearings, batch kernel vs. one by one
+        static int samplesGreatCircleKernel(QTextStream &out);
+
     private:
         static const qint64 DeltaTime = 10;
 
@@ -29,6 +29,10 @@
 #include <QPair>
 #include <QStringBuilder>
 #include <QJSEngine>
+#include <QMutexLocker>
+#include <QReadLocker>
+#include <QWriteLocker>
+#include <QThreadStorage>
 
 using namespace BlackMisc;
 using namespace BlackMisc::Aviation;
@@ -37,6 +41,90 @@ using namespace BlackMisc::Simulation;
 
 namespace BlackCore
 {
+    namespace
+    {
+        //! Index can be used instead of searching in models
+        bool useIndex(const CAircraftModelSetIndex *index, const CAircraftModelList &models)
+        {
+            return index && index->isIndexOf(models);
+        }
+
+        //! Matching script engine of one thread
+        //! \remark the wrapper objects are exposed once and reused, a script is compiled once per content
+        class CMatchingScriptEngine
+        {
+        public:
+            //! Ctor
+            CMatchingScriptEngine()
+            {
+                // engine.installExtensions(QJSEngine::ConsoleExtension);
+                this->expose("inObject",      &m_inObject);      // object as from network
+                this->expose("outObject",     &m_outObject);     // object that will be returned
+                this->expose("matchedObject", &m_matchedObject); // object as matched so far, same as inObject in reverse lookup
+                this->expose("modelSet",      &m_modelSet);      // wrapper for model set
+                this->expose("webServices",   &m_webServices);   // wrapper for web services
+            }
+
+            //! Engine of the current thread
+            static CMatchingScriptEngine &forCurrentThread()
+            {
+                static QThreadStorage<CMatchingScriptEngine *> engines;
+                if (!engines.hasLocalData()) { engines.setLocalData(new CMatchingScriptEngine()); }
+                return *engines.localData();
+            }
+
+            //! Init the wrapper objects
+            void init(const CAircraftModel &inModel, const CAircraftModel &matchedModel, const CAircraftModelList &modelSet)
+            {
+                m_inObject.initByModel(inModel);
+                m_matchedObject.initByModel(matchedModel); // same as inModel for reverse lookup
+                m_matchedObject.evaluateChanges(inModel.getAircraftIcaoCode(), inModel.getAirlineIcaoCode());
+                m_outObject.initByModel(matchedModel);     // set default values for out object
+                m_modelSet.initByModelSet(modelSet);       // as passed, implicitly shared
+                m_modelSet.initByAircraftAndAirline(inModel.getAircraftIcaoCode(), inModel.getAirlineIcaoCode());
+            }
+
+            //! Run script, compiled again only if the script content has changed
+            QJSValue run(MatchingScript script, const QString &js, const QString &fileName)
+            {
+                CompiledScript &compiled = m_compiled[script == ReverseLookup ? 0 : 1];
+                const uint hash = qHash(js);
+                if (compiled.hash != hash || compiled.js != js)
+                {
+                    compiled.hash = hash;
+                    compiled.js = js;
+                    compiled.function = m_engine.evaluate(js, fileName);
+                }
+                return compiled.function.isCallable() ? compiled.function.call() : compiled.function;
+            }
+
+        private:
+            //! Script compiled to a function
+            struct CompiledScript
+            {
+                uint hash = 0;
+                QString js;
+                QJSValue function;
+            };
+
+            //! Expose object as global property, owned by this class
+            void expose(const QString &name, QObject *object)
+            {
+                QJSEngine::setObjectOwnership(object, QJSEngine::CppOwnership);
+                m_engine.globalObject().setProperty(name, m_engine.newQObject(object));
+            }
+
+            // declared before the engine, so they are destroyed after it
+            MSInOutValues m_inObject;
+            MSInOutValues m_outObject;
+            MSInOutValues m_matchedObject;
+            MSModelSet    m_modelSet;
+            MSWebServices m_webServices;
+            QJSEngine     m_engine;
+            CompiledScript m_compiled[2]; //!< per MatchingScript
+        };
+    }
+
     const QStringList &CAircraftMatcher::getLogCategories()
     {
         static const QStringList cats { CLogCategories::matching() };
@@ -48,8 +136,7 @@ namespace BlackCore
         if (sApp && sApp->hasWebDataServices())
         {
             sApp->getWebDataServices()->synchronizeDbCaches(CEntityFlags::AircraftCategoryEntity);
-            const CAircraftCategoryList categories = sApp->getWebDataServices()->getAircraftCategories();
-            m_categoryMatcher.setCategories(categories);
+            this->setCategories(sApp->getWebDataServices()->getAircraftCategories());
         }
     }
 
@@ -64,7 +151,17 @@ namespace BlackCore
     bool CAircraftMatcher::setSetup(const CAircraftMatcherSetup &setup)
     {
         if (m_setup == setup) { return false; }
-        m_setup = setup;
+        const CAircraftMatcherSetup::MatchingMode exclusions = CAircraftMatcherSetup::ExcludeDefault;
+        bool exclusionsChanged = false;
+        CAircraftModelList modelSet;
+        {
+            QWriteLocker l(&m_lockMatching);
+            exclusionsChanged = (m_setup.getMatchingMode() & exclusions) != (setup.getMatchingMode() & exclusions);
+            m_setup = setup;
+            modelSet = m_modelSet;
+        }
+        if (exclusionsChanged) { this->setMatchingModelSet(modelSet); } // models excluded by setup changed
+        this->clearMatchingCache();
         emit this->setupChanged();
         return true;
     }
@@ -252,8 +349,22 @@ namespace BlackCore
 
     CAircraftModel CAircraftMatcher::getClosestMatch(const CSimulatedAircraft &remoteAircraft, MatchingLog whatToLog, CStatusMessageList *log, bool useMatchingScript) const
     {
-        CAircraftModelList modelSet(m_modelSet); // Models for this matching
-        const CAircraftMatcherSetup setup = m_setup;
+        // snapshot of models and setup for this matching, matching can run in a background thread
+        CAircraftModelList modelSet;
+        CAircraftMatcherSetup setup;
+        CAircraftModelSetIndex modelSetIndex;
+        MatchingModelSet matchingSet;
+        CCategoryMatcher categoryMatcher;
+        CAircraftModel defaultModel;
+        {
+            QReadLocker l(&m_lockMatching);
+            modelSet = m_modelSet;
+            setup = m_setup;
+            modelSetIndex = m_modelSetIndex;
+            matchingSet = m_matchingModelSet;
+            categoryMatcher = m_categoryMatcher;
+            defaultModel = m_defaultModel;
+        }
 
         static const QString format("hh:mm:ss.zzz");
         static const QString m1("--- Start matching: UTC %1 ---");
@@ -299,7 +410,7 @@ namespace BlackCore
         else if (modelSet.isEmpty())
         {
             CMatchingUtils::addLogDetailsToList(log, remoteAircraft, QStringLiteral("No models for matching, using default"), getLogCategories(), CStatusMessage::SeverityError);
-            matchedModel = this->getDefaultModel();
+            matchedModel = defaultModel;
             resolvedInPrephase = true;
         }
         else if (remoteAircraft.hasModelString())
@@ -307,7 +418,7 @@ namespace BlackCore
             // try to find in installed models by model string
             if (setup.getMatchingMode().testFlag(CAircraftMatcherSetup::ByModelString))
             {
-                matchedModel = matchByExactModelString(remoteAircraft, modelSet, whatToLog, log);
+                matchedModel = matchByExactModelString(remoteAircraft, modelSet, whatToLog, log, &modelSetIndex);
                 if (matchedModel.hasModelString())
                 {
                     CMatchingUtils::addLogDetailsToList(log, remoteAircraft, u"Exact match by model string '" % matchedModel.getModelStringAndDbKey() % "'", getLogCategories(), CStatusMessage::SeverityError);
@@ -322,50 +433,89 @@ namespace BlackCore
 
         if (!resolvedInPrephase)
         {
-            // sanity
-            const int noString = modelSet.removeAllWithoutModelString();
-            static const QString noModelStr("Excluded %1 models without model string");
-            if (noString > 0 && log) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, noModelStr.arg(noString)); }
+            // sanity and exclusion, done when the model set or setup changed
+            modelSet = matchingSet.models;
+            if (log)
+            {
+                static const QString noModelStr("Excluded %1 models without model string");
+                static const QString noDbKeyStr("Excluded %1 models without DB key");
+                static const QString excludedStr("Excluded %1 models marked 'Excluded'");
+                if (matchingSet.noModelString > 0) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, noModelStr.arg(matchingSet.noModelString)); }
+                if (matchingSet.noDbKey > 0) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, noDbKeyStr.arg(matchingSet.noDbKey)); }
+                if (matchingSet.excluded > 0) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, excludedStr.arg(matchingSet.excluded)); }
+            }
 
-            // exclusion
-            if (setup.getMatchingMode().testFlag(CAircraftMatcherSetup::ExcludeNoDbData))
+            // same aircraft/airline/livery/model string combination matched before?
+            const QString cacheKey = CAircraftMatcher::matchingCacheKey(remoteAircraft);
+            MatchingCacheEntry result;
+            bool cached = false;
+            int cacheVersion = 0;
             {
-                const int noDbKey = modelSet.removeObjectsWithoutDbKey();
-                static const QString excludedStr("Excluded %1 models without DB key");
-                if (noDbKey > 0 && log) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, excludedStr.arg(noDbKey)); }
+                QMutexLocker l(&m_matchingCacheMutex);
+                cacheVersion = m_matchingCacheVersion;
+                const MatchingCacheEntry *entry = m_matchingCache.object(cacheKey);
+                if (entry && (!log || entry->whatToLog == whatToLog))
+                {
+                    result = *entry;
+                    cached = true;
+                }
             }
 
-            if (setup.getMatchingMode().testFlag(CAircraftMatcherSetup::ExcludeNoExcluded))
+            if (cached)
             {
-                const int excluded = modelSet.removeIfExcluded();
-                static const QString excludedStr("Excluded %1 models marked 'Excluded'");
-                if (excluded > 0 && log) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, excludedStr.arg(excluded)); }
+                m_matchingCacheHits++;
+                if (log)
+                {
+                    CMatchingUtils::addLogDetailsToList(log, remoteAircraft, QStringLiteral("Using cached matching result of same aircraft, airline, livery and model string"), getLogCategories());
+                    log->push_back(CAircraftMatcher::replaceLogCallsign(result.log, result.callsign, remoteAircraft.getCallsign()));
+                }
             }
+            else
+            {
+                m_matchingCacheMisses++;
+                const int logStart = log ? log->size() : 0;
 
-            // Reduce by ICAO if the flag is set
-            static const QString msInfo("Using '%1' with model set with %2 models");
-            CMatchingUtils::addLogDetailsToList(log, remoteAircraft, msInfo.arg(setup.getMatchingAlgorithmAsString()).arg(modelSet.size()), getLogCategories());
-            CAircraftModelList candidates;
-            int maxScore = -1;
+                // Reduce by ICAO if the flag is set
+                static const QString msInfo("Using '%1' with model set with %2 models");
+                CMatchingUtils::addLogDetailsToList(log, remoteAircraft, msInfo.arg(setup.getMatchingAlgorithmAsString()).arg(modelSet.size()), getLogCategories());
+                int maxScore = -1;
 
-            switch (setup.getMatchingAlgorithm())
-            {
-            case CAircraftMatcherSetup::MatchingStepwiseReduce:
-                candidates = CAircraftMatcher::getClosestMatchStepwiseReduceImplementation(modelSet, setup, m_categoryMatcher, remoteAircraft, whatToLog, log);
-                break;
-            case CAircraftMatcherSetup::MatchingScoreBased:
-                candidates = CAircraftMatcher::getClosestMatchScoreImplementation(modelSet, setup, remoteAircraft, maxScore, whatToLog, log);
-                break;
-            case CAircraftMatcherSetup::MatchingStepwiseReducePlusScoreBased:
-            default:
-                candidates = CAircraftMatcher::getClosestMatchStepwiseReduceImplementation(modelSet, setup, m_categoryMatcher, remoteAircraft, whatToLog, log);
-                candidates = CAircraftMatcher::getClosestMatchScoreImplementation(candidates, setup, remoteAircraft, maxScore, whatToLog, log);
-                break;
+                switch (setup.getMatchingAlgorithm())
+                {
+                case CAircraftMatcherSetup::MatchingStepwiseReduce:
+                    result.candidates = CAircraftMatcher::getClosestMatchStepwiseReduceImplementation(modelSet, setup, categoryMatcher, remoteAircraft, whatToLog, log, &matchingSet.index);
+                    break;
+                case CAircraftMatcherSetup::MatchingScoreBased:
+                    result.candidates = CAircraftMatcher::getClosestMatchScoreImplementation(modelSet, setup, remoteAircraft, maxScore, whatToLog, log);
+                    break;
+                case CAircraftMatcherSetup::MatchingStepwiseReducePlusScoreBased:
+                default:
+                    result.candidates = CAircraftMatcher::getClosestMatchStepwiseReduceImplementation(modelSet, setup, categoryMatcher, remoteAircraft, whatToLog, log, &matchingSet.index);
+                    result.candidates = CAircraftMatcher::getClosestMatchScoreImplementation(result.candidates, setup, remoteAircraft, maxScore, whatToLog, log);
+                    break;
+                }
+
+                if (result.candidates.isEmpty())
+                {
+                    result.defaultModel = CAircraftMatcher::getCombinedTypeDefaultModel(modelSet, remoteAircraft, defaultModel, whatToLog, log, &matchingSet.index);
+                }
+
+                if (log)
+                {
+                    result.whatToLog = whatToLog;
+                    result.callsign = remoteAircraft.getCallsign();
+                    for (int i = logStart; i < log->size(); ++i) { result.log.push_back((*log)[i]); }
+                }
+
+                // not cached if model set, setup or default model changed meanwhile
+                QMutexLocker l(&m_matchingCacheMutex);
+                if (cacheVersion == m_matchingCacheVersion) { m_matchingCache.insert(cacheKey, new MatchingCacheEntry(result)); }
             }
 
+            const CAircraftModelList &candidates = result.candidates;
             if (candidates.isEmpty())
             {
-                matchedModel = CAircraftMatcher::getCombinedTypeDefaultModel(modelSet, remoteAircraft, this->getDefaultModel(), whatToLog, log);
+                matchedModel = result.defaultModel;
             }
             else
             {
@@ -447,7 +597,6 @@ namespace BlackCore
         if (!matchedModel.hasModelString())
         {
             if (log) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, QStringLiteral("All matching yielded no result, VERY odd...")); }
-            CAircraftModel defaultModel = this->getDefaultModel();
             if (defaultModel.hasModelString())
             {
                 matchedModel = defaultModel;
@@ -546,48 +695,10 @@ namespace BlackCore
                 CCallsign::addLogDetailsToList(log, callsign, QStringLiteral("Matching script models: %1").arg(modelSet.coverageSummary()));
             }
 
-            QJSEngine engine;
-            // engine.installExtensions(QJSEngine::ConsoleExtension);
-
-            // Meta objects to create new JS objects, here causing JSValue can't be reassigned to another engine.
-            // static const QJSValue jsInOutMetaObject = engine.newQMetaObject(&MSInOutValues::staticMetaObject);
-            // engine.globalObject().setProperty("SwiftInOutObject", jsInOutMetaObject); // JS: new SwiftInOutObject();
-            // static const QJSValue jsSetMetaObject = engine.newQMetaObject(&MSModelSet::staticMetaObject);
-            // engine.globalObject().setProperty("SwiftModelSet", jsSetMetaObject); // JS: new SwiftModelSet
-            // static const QJSValue jsWebServicesMetaObject = engine.newQMetaObject(&MSWebServices::staticMetaObject);
-            // engine.globalObject().setProperty("SwiftWebServices", jsWebServicesMetaObject); // JS: new SwiftWebServices
-
-            // init models and set
-            MSInOutValues inObject(inModel);
-            MSInOutValues matchedObject(matchedModel); // same as inModel for reverse lookup
-            matchedObject.evaluateChanges(inModel.getAircraftIcaoCode(), inModel.getAirlineIcaoCode());
-            MSInOutValues outObject(matchedModel);     // set default values for out object
-            MSModelSet modelSetObject(modelSet);       // as passed
-            modelSetObject.initByAircraftAndAirline(inModel.getAircraftIcaoCode(), inModel.getAirlineIcaoCode());
-            MSWebServices webServices; // web services encapsulated
-
-            // object as from network
-            const QJSValue jsInObject = engine.newQObject(&inObject);
-            engine.globalObject().setProperty("inObject", jsInObject);
-
-            // object that will be returned
-            const QJSValue jsOutObject = engine.newQObject(&outObject);
-            engine.globalObject().setProperty("outObject", jsOutObject);
-
-            // object as matched so far, same as inObject in reverse lookup
-            const QJSValue jsMatchedObject = engine.newQObject(&matchedObject);
-            engine.globalObject().setProperty("matchedObject", jsMatchedObject);
-
-            // wrapper for model set
-            const QJSValue jsModelSetObject = engine.newQObject(&modelSetObject);
-            engine.globalObject().setProperty("modelSet", jsModelSetObject);
-
-            // wrapper for web services
-            const QJSValue jsWebServices = engine.newQObject(&webServices);
-            engine.globalObject().setProperty("webServices", jsWebServices);
-
-            QJSValue ms = engine.evaluate(js, msReverse ? logFileR : logFileM);
-            ms = ms.call();
+            // engine, wrappers and compiled script are reused per thread
+            CMatchingScriptEngine &engine = CMatchingScriptEngine::forCurrentThread();
+            engine.init(inModel, matchedModel, modelSet);
+            const QJSValue ms = engine.run(script, js, msReverse ? logFileR : logFileM);
             if (ms.isError())
             {
                 const QString msg = QStringLiteral("Matching script error: %1 '%2'").arg(ms.property("lineNumber").toInt()).arg(ms.toString());
@@ -1291,7 +1402,7 @@ namespace BlackCore
         }
 
         // set values
-        m_modelSet  = modelsCleaned;
+        this->setMatchingModelSet(modelsCleaned);
         m_simulator = simulator;
         m_modelSetInfo = QStringLiteral("Set: '%1' entries: %2").arg(simulator.toQString()).arg(modelsCleaned.size());
         return models.size();
@@ -1299,28 +1410,135 @@ namespace BlackCore
 
     void CAircraftMatcher::disableModelsForMatching(const CAircraftModelList &removedModels, bool incremental)
     {
+        CAircraftModelList modelSet(m_modelSet);
         if (incremental)
         {
-            m_modelSet.removeModelsWithString(removedModels, Qt::CaseInsensitive);
+            modelSet.removeModelsWithString(removedModels, Qt::CaseInsensitive);
             m_disabledModels.push_back(removedModels);
         }
         else
         {
-            this->restoreDisabledModels();
+            modelSet.replaceOrAddModelsWithString(m_disabledModels, Qt::CaseInsensitive); // restore
             m_disabledModels = removedModels;
-            m_modelSet.removeModelsWithString(removedModels, Qt::CaseInsensitive);
+            modelSet.removeModelsWithString(removedModels, Qt::CaseInsensitive);
         }
+        this->setMatchingModelSet(modelSet);
     }
 
     void CAircraftMatcher::restoreDisabledModels()
     {
-        m_modelSet.replaceOrAddModelsWithString(m_disabledModels, Qt::CaseInsensitive);
+        CAircraftModelList modelSet(m_modelSet);
+        modelSet.replaceOrAddModelsWithString(m_disabledModels, Qt::CaseInsensitive);
+        this->setMatchingModelSet(modelSet);
     }
 
     void CAircraftMatcher::setDefaultModel(const CAircraftModel &defaultModel)
     {
-        m_defaultModel = defaultModel;
-        m_defaultModel.setModelType(CAircraftModel::TypeModelMatchingDefaultModel);
+        CAircraftModel model(defaultModel);
+        model.setModelType(CAircraftModel::TypeModelMatchingDefaultModel);
+        {
+            QWriteLocker l(&m_lockMatching);
+            m_defaultModel = model;
+        }
+        this->clearMatchingCache();
+    }
+
+    void CAircraftMatcher::setCategories(const CAircraftCategoryList &categories)
+    {
+        {
+            QWriteLocker l(&m_lockMatching);
+            m_categoryMatcher.setCategories(categories);
+        }
+        this->clearMatchingCache();
+    }
+
+    void CAircraftMatcher::setMatchingModelSet(const CAircraftModelList &modelSet)
+    {
+        CAircraftMatcherSetup setup;
+        {
+            QReadLocker l(&m_lockMatching);
+            setup = m_setup;
+        }
+
+        // built before locking, the indexes share the data of the model sets
+        const CAircraftModelSetIndex index(modelSet);
+        const MatchingModelSet matchingSet = CAircraftMatcher::matchingModelSet(modelSet, index, setup);
+        {
+            QWriteLocker l(&m_lockMatching);
+            m_modelSet = modelSet;
+            m_modelSetIndex = index;
+            m_matchingModelSet = matchingSet;
+        }
+        this->clearMatchingCache();
+    }
+
+    CAircraftMatcher::MatchingModelSet CAircraftMatcher::matchingModelSet(const CAircraftModelList &modelSet, const CAircraftModelSetIndex &modelSetIndex, const CAircraftMatcherSetup &setup)
+    {
+        MatchingModelSet matchingSet;
+        matchingSet.models = modelSet;
+        matchingSet.noModelString = matchingSet.models.removeAllWithoutModelString();
+        if (setup.getMatchingMode().testFlag(CAircraftMatcherSetup::ExcludeNoDbData))   { matchingSet.noDbKey = matchingSet.models.removeObjectsWithoutDbKey(); }
+        if (setup.getMatchingMode().testFlag(CAircraftMatcherSetup::ExcludeNoExcluded)) { matchingSet.excluded = matchingSet.models.removeIfExcluded(); }
+
+        // nothing removed, the list still shares the data of modelSet
+        const bool removed = matchingSet.noModelString > 0 || matchingSet.noDbKey > 0 || matchingSet.excluded > 0;
+        matchingSet.index = removed ? CAircraftModelSetIndex(matchingSet.models) : modelSetIndex;
+        return matchingSet;
+    }
+
+    CMatchingStatistics CAircraftMatcher::getCurrentStatistics() const
+    {
+        CMatchingStatistics statistics(m_statistics);
+        statistics.setMatchingCacheCounts(m_matchingCacheHits, m_matchingCacheMisses);
+        return statistics;
+    }
+
+    void CAircraftMatcher::clearMatchingStatistics()
+    {
+        m_statistics.clear();
+        m_matchingCacheHits = 0;
+        m_matchingCacheMisses = 0;
+    }
+
+    void CAircraftMatcher::clearMatchingCache()
+    {
+        QMutexLocker l(&m_matchingCacheMutex);
+        m_matchingCache.clear();
+        m_matchingCacheVersion++;
+    }
+
+    QString CAircraftMatcher::matchingCacheKey(const CSimulatedAircraft &remoteAircraft)
+    {
+        const CAircraftModel &model = remoteAircraft.getModel();
+        const CAircraftIcaoCode &aircraft = model.getAircraftIcaoCode();
+        const CAirlineIcaoCode &airline = model.getAirlineIcaoCode();
+        const CLivery &livery = model.getLivery();
+        const QChar sep('|');
+        return aircraft.getDesignator() % sep % QString::number(aircraft.getDbKey()) % sep %
+               aircraft.getCombinedType() % sep % aircraft.getFamily() % sep % aircraft.getManufacturer() % sep %
+               QString::number(aircraft.getCategory().getDbKey()) % sep % boolToYesNo(aircraft.isMilitary()) % sep %
+               airline.getDesignator() % sep % airline.getVDesignator() % sep % QString::number(airline.getDbKey()) % sep %
+               airline.getGroupDesignator() % sep %
+               livery.getCombinedCode() % sep % QString::number(livery.getDbKey()) % sep %
+               livery.getColorFuselage().hex() % sep % livery.getColorTail().hex() % sep % boolToYesNo(livery.isMilitary()) % sep %
+               model.getModelString();
+    }
+
+    CStatusMessageList CAircraftMatcher::replaceLogCallsign(const CStatusMessageList &log, const CCallsign &from, const CCallsign &to)
+    {
+        if (from == to) { return log; }
+
+        // messages are prefixed "callsign: " by CCallsign::logMessage
+        const QString fromPrefix = from.isEmpty() ? QString() : from.toQString() + ": ";
+        const QString toPrefix   = to.isEmpty()   ? QString() : to.toQString() + ": ";
+        CStatusMessageList replaced;
+        for (CStatusMessage msg : log)
+        {
+            const QString m = msg.getMessage();
+            if (m.startsWith(fromPrefix)) { msg.log(msg.getSeverity(), toPrefix + m.mid(fromPrefix.length())); }
+            replaced.push_back(msg);
+        }
+        return replaced;
     }
 
     void CAircraftMatcher::evaluateStatisticsEntry(const QString &sessionId, const CCallsign &callsign, const QString &aircraftIcao, const QString &airlineIcao, const QString &livery)
@@ -1391,7 +1609,7 @@ namespace BlackCore
         return CFileUtils::writeStringToFile(json, CFileUtils::appendFilePathsAndFixUnc(CSwiftDirectories::logDirectory(), QStringLiteral("removed models %1.json").arg(ts)));
     }
 
-    CAircraftModelList CAircraftMatcher::getClosestMatchStepwiseReduceImplementation(const CAircraftModelList &modelSet, const CAircraftMatcherSetup &setup, const CCategoryMatcher &categoryMatcher, const CSimulatedAircraft &remoteAircraft, MatchingLog whatToLog, CStatusMessageList *log)
+    CAircraftModelList CAircraftMatcher::getClosestMatchStepwiseReduceImplementation(const CAircraftModelList &modelSet, const CAircraftMatcherSetup &setup, const CCategoryMatcher &categoryMatcher, const CSimulatedAircraft &remoteAircraft, MatchingLog whatToLog, CStatusMessageList *log, const CAircraftModelSetIndex *index)
     {
         CAircraftModelList matchedModels(modelSet);
         CAircraftModel matchedModel(remoteAircraft.getModel());
@@ -1405,7 +1623,7 @@ namespace BlackCore
             // by livery, then by ICAO
             if (mode.testFlag(CAircraftMatcherSetup::ByLivery))
             {
-                matchedModels = ifPossibleReduceByLiveryAndAircraftIcaoCode(remoteAircraft, matchedModels, reduced, log);
+                matchedModels = ifPossibleReduceByLiveryAndAircraftIcaoCode(remoteAircraft, matchedModels, reduced, log, index);
                 if (reduced) { break; } // almost perfect, we stop here (we have ICAO + livery match)
             }
             else if (reduceLog)
@@ -1417,7 +1635,7 @@ namespace BlackCore
             {
                 // by airline/aircraft or by aircraft/airline depending on setup
                 // family is also considered
-                matchedModels = ifPossibleReduceByIcaoData(remoteAircraft, matchedModels, setup, reduced, log);
+                matchedModels = ifPossibleReduceByIcaoData(remoteAircraft, matchedModels, setup, reduced, log, index);
             }
             else if (reduceLog)
             {
@@ -1427,7 +1645,7 @@ namespace BlackCore
                 if (mode.testFlag(CAircraftMatcherSetup::ByFamily))
                 {
                     QString usedFamily;
-                    matchedModels = ifPossibleReduceByFamily(remoteAircraft, UsePseudoFamily, matchedModels, reduced, usedFamily, log);
+                    matchedModels = ifPossibleReduceByFamily(remoteAircraft, UsePseudoFamily, matchedModels, reduced, usedFamily, log, index);
                     if (reduced) { break; }
                 }
                 else if (reduceLog)
@@ -1470,7 +1688,7 @@ namespace BlackCore
             // combined code
             if (mode.testFlag(CAircraftMatcherSetup::ByCombinedType))
             {
-                matchedModels = ifPossibleReduceByCombinedType(remoteAircraft, matchedModels, setup, reduced, reduceLog);
+                matchedModels = ifPossibleReduceByCombinedType(remoteAircraft, matchedModels, setup, reduced, reduceLog, index);
                 if (reduced) { break; }
             }
             else if (log)
@@ -1483,7 +1701,7 @@ namespace BlackCore
         // here we have a list of possible models, we reduce/refine further
         if (matchedModels.size() > 1 && mode.testFlag(CAircraftMatcherSetup::ByManufacturer))
         {
-            matchedModels = ifPossibleReduceByManufacturer(remoteAircraft, matchedModels, QStringLiteral("2nd trial to reduce by manufacturer. "), reduced, reduceLog);
+            matchedModels = ifPossibleReduceByManufacturer(remoteAircraft, matchedModels, QStringLiteral("2nd trial to reduce by manufacturer. "), reduced, reduceLog, index);
         }
 
         return matchedModels;
@@ -1497,8 +1715,18 @@ namespace BlackCore
         CStatusMessageList *scoreLog = log && whatToLog.testFlag(MatchingLogScoring) ? log : nullptr;
 
         // VTOL
+        // without scoring log only the best models are needed
         ScoredModels map;
-        map = modelSet.scoreFull(remoteAircraft.getModel(), preferColorLiveries, noZeroScores, scoreLog);
+        int scoredModels = 0;
+        if (scoreLog)
+        {
+            map = modelSet.scoreFull(remoteAircraft.getModel(), preferColorLiveries, noZeroScores, scoreLog);
+            scoredModels = map.size();
+        }
+        else
+        {
+            map = modelSet.scoreBest(remoteAircraft.getModel(), preferColorLiveries, noZeroScores, &scoredModels);
+        }
 
         CAircraftModel matchedModel;
         if (map.isEmpty()) { return CAircraftModelList(); }
@@ -1506,11 +1734,11 @@ namespace BlackCore
         maxScore = map.lastKey();
         const CAircraftModelList maxScoreAircraft(map.values(maxScore));
         CMatchingUtils::addLogDetailsToList(scoreLog, remoteAircraft, QStringLiteral("Scores: %1").arg(scoresToString(map)), getLogCategories());
-        CMatchingUtils::addLogDetailsToList(log, remoteAircraft, QStringLiteral("Scoring with score %1 out of %2 models yielded %3 models").arg(maxScore).arg(map.size()).arg(maxScoreAircraft.size()), getLogCategories());
+        if (log) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, QStringLiteral("Scoring with score %1 out of %2 models yielded %3 models").arg(maxScore).arg(scoredModels).arg(maxScoreAircraft.size()), getLogCategories()); }
         return maxScoreAircraft;
     }
 
-    CAircraftModel CAircraftMatcher::getCombinedTypeDefaultModel(const CAircraftModelList &modelSet, const CSimulatedAircraft &remoteAircraft, const CAircraftModel &defaultModel, MatchingLog whatToLog, CStatusMessageList *log)
+    CAircraftModel CAircraftMatcher::getCombinedTypeDefaultModel(const CAircraftModelList &modelSet, const CSimulatedAircraft &remoteAircraft, const CAircraftModel &defaultModel, MatchingLog whatToLog, CStatusMessageList *log, const CAircraftModelSetIndex *index)
     {
         const QString combinedType = remoteAircraft.getAircraftIcaoCombinedType();
         CStatusMessageList *combinedLog = log && whatToLog.testFlag(MatchingLogCombinedDefaultType) ? log : nullptr;
@@ -1527,7 +1755,9 @@ namespace BlackCore
         }
 
         CMatchingUtils::addLogDetailsToList(combinedLog, remoteAircraft, u"Searching by combined type with color livery '" % combinedType % "'", getLogCategories());
-        CAircraftModelList matchedModels = modelSet.findByCombinedTypeWithColorLivery(combinedType);
+        CAircraftModelList matchedModels = useIndex(index, modelSet) ?
+                                           index->findByCombinedType(combinedType).findColorLiveries() :
+                                           modelSet.findByCombinedTypeWithColorLivery(combinedType);
         if (!matchedModels.isEmpty())
         {
             CMatchingUtils::addLogDetailsToList(combinedLog, remoteAircraft, u"Found " % QString::number(matchedModels.size()) % u" by combined type w/color livery '" % combinedType % "'", getLogCategories());
@@ -1547,7 +1777,7 @@ namespace BlackCore
         return matchedModels.front();
     }
 
-    CAircraftModel CAircraftMatcher::matchByExactModelString(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &models, MatchingLog whatToLog, CStatusMessageList *log)
+    CAircraftModel CAircraftMatcher::matchByExactModelString(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &models, MatchingLog whatToLog, CStatusMessageList *log, const CAircraftModelSetIndex *index)
     {
         CStatusMessageList *msLog = log && whatToLog.testFlag(MatchingLogModelstring) ? log : nullptr;
         if (remoteAircraft.getModelString().isEmpty())
@@ -1556,7 +1786,9 @@ namespace BlackCore
             return CAircraftModel();
         }
 
-        CAircraftModel model = models.findFirstByModelStringAliasOrDefault(remoteAircraft.getModelString());
+        CAircraftModel model = useIndex(index, models) ?
+                               index->findFirstByModelStringAliasOrDefault(remoteAircraft.getModelString()) :
+                               models.findFirstByModelStringAliasOrDefault(remoteAircraft.getModelString());
         if (msLog)
         {
             if (model.hasModelString())
@@ -1573,7 +1805,7 @@ namespace BlackCore
         return model;
     }
 
-    CAircraftModelList CAircraftMatcher::ifPossibleReduceByLiveryAndAircraftIcaoCode(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &inList, bool &reduced, CStatusMessageList *log)
+    CAircraftModelList CAircraftMatcher::ifPossibleReduceByLiveryAndAircraftIcaoCode(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &inList, bool &reduced, CStatusMessageList *log, const CAircraftModelSetIndex *index)
     {
         reduced = false;
         if (!remoteAircraft.getLivery().hasCombinedCode())
@@ -1582,7 +1814,11 @@ namespace BlackCore
             return inList;
         }
 
-        const CAircraftModelList byLivery(
+        const CAircraftModelList byLivery(useIndex(index, inList) ?
+            index->findByAircraftDesignatorAndLiveryCombinedCode(
+                remoteAircraft.getLivery().getCombinedCode(),
+                remoteAircraft.getAircraftIcaoCodeDesignator()
+            ) :
             inList.findByAircraftDesignatorAndLiveryCombinedCode(
                 remoteAircraft.getLivery().getCombinedCode(),
                 remoteAircraft.getAircraftIcaoCodeDesignator()
@@ -1597,7 +1833,7 @@ namespace BlackCore
         return byLivery;
     }
 
-    CAircraftModelList CAircraftMatcher::ifPossibleReduceByIcaoData(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &inList, const CAircraftMatcherSetup &setup, bool &reduced, CStatusMessageList *log)
+    CAircraftModelList CAircraftMatcher::ifPossibleReduceByIcaoData(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &inList, const CAircraftMatcherSetup &setup, bool &reduced, CStatusMessageList *log, const CAircraftModelSetIndex *index)
     {
         const CAircraftMatcherSetup::MatchingMode mode = setup.getMatchingMode();
         if (inList.isEmpty())
@@ -1611,8 +1847,8 @@ namespace BlackCore
         {
             bool r1 = false;
             bool r2 = false;
-            CAircraftModelList models = ifPossibleReduceByAirline(remoteAircraft, inList, setup, QStringLiteral("Reduce by airline first."), r1, log);
-            models = ifPossibleReduceByAircraftOrFamily(remoteAircraft, UsePseudoFamily, models, setup, QStringLiteral("Reduce by aircraft ICAO second."), r2, log);
+            CAircraftModelList models = ifPossibleReduceByAirline(remoteAircraft, inList, setup, QStringLiteral("Reduce by airline first."), r1, log, index);
+            models = ifPossibleReduceByAircraftOrFamily(remoteAircraft, UsePseudoFamily, models, setup, QStringLiteral("Reduce by aircraft ICAO second."), r2, log, index);
             reduced = r1 || r2;
             if (reduced) { return models; }
         }
@@ -1620,8 +1856,8 @@ namespace BlackCore
         {
             bool r1 = false;
             bool r2 = false;
-            CAircraftModelList models = ifPossibleReduceByAircraftOrFamily(remoteAircraft, UsePseudoFamily, inList, setup, QStringLiteral("Reduce by aircraft ICAO first."), r1, log);
-            models = ifPossibleReduceByAirline(remoteAircraft, models, setup, QStringLiteral("Reduce aircraft ICAO by airline second."), r2, log);
+            CAircraftModelList models = ifPossibleReduceByAircraftOrFamily(remoteAircraft, UsePseudoFamily, inList, setup, QStringLiteral("Reduce by aircraft ICAO first."), r1, log, index);
+            models = ifPossibleReduceByAirline(remoteAircraft, models, setup, QStringLiteral("Reduce aircraft ICAO by airline second."), r2, log, index);
 
             // not finding anything so far means we have no valid aircraft/airline ICAO combination
             // but it can happen we found B738, and for DLH there is no B738 but B737, so we search again
@@ -1635,8 +1871,8 @@ namespace BlackCore
 
                 bool r3 = false;
                 QString usedFamily;
-                CAircraftModelList models2nd = ifPossibleReduceByFamily(remoteAircraft, UsePseudoFamily, inList, r3, usedFamily, log);
-                models2nd = ifPossibleReduceByAirline(remoteAircraft, models2nd, setup, "Reduce family by airline second.", r3, log);
+                CAircraftModelList models2nd = ifPossibleReduceByFamily(remoteAircraft, UsePseudoFamily, inList, r3, usedFamily, log, index);
+                models2nd = ifPossibleReduceByAirline(remoteAircraft, models2nd, setup, "Reduce family by airline second.", r3, log, index);
                 if (r3)
                 {
                     // we found family / airline combination
@@ -1657,22 +1893,22 @@ namespace BlackCore
         return inList;
     }
 
-    CAircraftModelList CAircraftMatcher::ifPossibleReduceByFamily(const CSimulatedAircraft &remoteAircraft, bool allowPseudoFamily, const CAircraftModelList &inList, bool &reduced, QString &usedFamily, CStatusMessageList *log)
+    CAircraftModelList CAircraftMatcher::ifPossibleReduceByFamily(const CSimulatedAircraft &remoteAircraft, bool allowPseudoFamily, const CAircraftModelList &inList, bool &reduced, QString &usedFamily, CStatusMessageList *log, const CAircraftModelSetIndex *index)
     {
         reduced = false;
         usedFamily = remoteAircraft.getAircraftIcaoCode().getFamily();
         if (!usedFamily.isEmpty())
         {
-            CAircraftModelList matchedModels = ifPossibleReduceByFamily(remoteAircraft, usedFamily, allowPseudoFamily, inList, QStringLiteral("real family from ICAO"), reduced, log);
+            CAircraftModelList matchedModels = ifPossibleReduceByFamily(remoteAircraft, usedFamily, allowPseudoFamily, inList, QStringLiteral("real family from ICAO"), reduced, log, index);
             if (reduced) { return matchedModels; }
         }
 
         // scenario: the ICAO actually is the family
         usedFamily = remoteAircraft.getAircraftIcaoCodeDesignator();
-        return ifPossibleReduceByFamily(remoteAircraft, usedFamily, allowPseudoFamily, inList, QStringLiteral("ICAO treated as family"), reduced, log);
+        return ifPossibleReduceByFamily(remoteAircraft, usedFamily, allowPseudoFamily, inList, QStringLiteral("ICAO treated as family"), reduced, log, index);
     }
 
-    CAircraftModelList CAircraftMatcher::ifPossibleReduceByFamily(const CSimulatedAircraft &remoteAircraft, const QString &family, bool allowPseudoFamily, const CAircraftModelList &inList, const QString &hint, bool &reduced, CStatusMessageList *log)
+    CAircraftModelList CAircraftMatcher::ifPossibleReduceByFamily(const CSimulatedAircraft &remoteAircraft, const QString &family, bool allowPseudoFamily, const CAircraftModelList &inList, const QString &hint, bool &reduced, CStatusMessageList *log, const CAircraftModelSetIndex *index)
     {
         // Use an algorithm to find the best match
         reduced = false;
@@ -1688,7 +1924,8 @@ namespace BlackCore
             return inList;
         }
 
-        CAircraftModelList foundByFamily(inList.findByFamily(family));
+        const bool indexed = useIndex(index, inList);
+        CAircraftModelList foundByFamily(indexed ? index->findByFamily(family) : inList.findByFamily(family));
         if (foundByFamily.isEmpty())
         {
             if (log) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, u"Not found by family '" % family % u"' (" % hint % ")"); }
@@ -1703,7 +1940,9 @@ namespace BlackCore
         CAircraftModelList foundByCM;
         if (allowPseudoFamily)
         {
-            foundByCM = inList.findByCombinedAndManufacturer(remoteAircraft.getAircraftIcaoCode());
+            foundByCM = indexed ?
+                        index->findByCombinedAndManufacturer(remoteAircraft.getAircraftIcaoCode()) :
+                        inList.findByCombinedAndManufacturer(remoteAircraft.getAircraftIcaoCode());
             const QString pseudo = remoteAircraft.getAircraftIcaoCode().getCombinedType() % "/" % remoteAircraft.getAircraftIcaoCode().getManufacturer();
             if (foundByCM.isEmpty())
             {
@@ -1726,7 +1965,7 @@ namespace BlackCore
         return foundByFamily;
     }
 
-    CAircraftModelList CAircraftMatcher::ifPossibleReduceByManufacturer(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &inList, const QString &info, bool &reduced, CStatusMessageList *log)
+    CAircraftModelList CAircraftMatcher::ifPossibleReduceByManufacturer(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &inList, const QString &info, bool &reduced, CStatusMessageList *log, const CAircraftModelSetIndex *index)
     {
         reduced = false;
         if (inList.isEmpty())
@@ -1742,7 +1981,7 @@ namespace BlackCore
             return inList;
         }
 
-        const CAircraftModelList outList(inList.findByManufacturer(m));
+        const CAircraftModelList outList(useIndex(index, inList) ? index->findByManufacturer(m) : inList.findByManufacturer(m));
         if (outList.isEmpty())
         {
             if (log) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, info % u" Not found '" % m % u"', cannot reduce", getLogCategories()); }
@@ -1782,7 +2021,7 @@ namespace BlackCore
         return outList;
     }
 
-    CAircraftModelList CAircraftMatcher::ifPossibleReduceByAircraft(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &inList, const QString &info, bool &reduced, CStatusMessageList *log)
+    CAircraftModelList CAircraftMatcher::ifPossibleReduceByAircraft(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &inList, const QString &info, bool &reduced, CStatusMessageList *log, const CAircraftModelSetIndex *index)
     {
         reduced = false;
         if (inList.isEmpty())
@@ -1797,7 +2036,9 @@ namespace BlackCore
             return inList;
         }
 
-        const CAircraftModelList outList(inList.findByIcaoDesignators(remoteAircraft.getAircraftIcaoCode(), CAirlineIcaoCode::null()));
+        const CAircraftModelList outList(useIndex(index, inList) ?
+                                         index->findByIcaoDesignators(remoteAircraft.getAircraftIcaoCode(), CAirlineIcaoCode::null()) :
+                                         inList.findByIcaoDesignators(remoteAircraft.getAircraftIcaoCode(), CAirlineIcaoCode::null()));
         if (outList.isEmpty())
         {
             if (log) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, info % u" Cannot reduce by '" % remoteAircraft.getAircraftIcaoCodeDesignator() % u"' results: " % QString::number(outList.size()), getLogCategories()); }
@@ -1809,16 +2050,16 @@ namespace BlackCore
         return outList;
     }
 
-    CAircraftModelList CAircraftMatcher::ifPossibleReduceByAircraftOrFamily(const CSimulatedAircraft &remoteAircraft, bool allowPseudoFamily, const CAircraftModelList &inList,  const CAircraftMatcherSetup &setup, const QString &info, bool &reduced, CStatusMessageList *log)
+    CAircraftModelList CAircraftMatcher::ifPossibleReduceByAircraftOrFamily(const CSimulatedAircraft &remoteAircraft, bool allowPseudoFamily, const CAircraftModelList &inList,  const CAircraftMatcherSetup &setup, const QString &info, bool &reduced, CStatusMessageList *log, const CAircraftModelSetIndex *index)
     {
         reduced = false;
-        const CAircraftModelList outList = ifPossibleReduceByAircraft(remoteAircraft, inList, info, reduced, log);
+        const CAircraftModelList outList = ifPossibleReduceByAircraft(remoteAircraft, inList, info, reduced, log, index);
         if (reduced || !setup.getMatchingMode().testFlag(CAircraftMatcherSetup::ByFamily)) { return outList; }
         QString family;
-        return ifPossibleReduceByFamily(remoteAircraft, allowPseudoFamily, inList, reduced, family, log);
+        return ifPossibleReduceByFamily(remoteAircraft, allowPseudoFamily, inList, reduced, family, log, index);
     }
 
-    CAircraftModelList CAircraftMatcher::ifPossibleReduceByAirline(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &inList, const CAircraftMatcherSetup &setup, const QString &info, bool &reduced, CStatusMessageList *log)
+    CAircraftModelList CAircraftMatcher::ifPossibleReduceByAirline(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &inList, const CAircraftMatcherSetup &setup, const QString &info, bool &reduced, CStatusMessageList *log, const CAircraftModelSetIndex *index)
     {
         reduced = false;
         if (inList.isEmpty())
@@ -1834,7 +2075,9 @@ namespace BlackCore
         }
 
         CAircraftMatcherSetup::MatchingMode mode = setup.getMatchingMode();
-        CAircraftModelList outList(inList.findByIcaoDesignators(CAircraftIcaoCode::null(), remoteAircraft.getAirlineIcaoCode()));
+        CAircraftModelList outList(useIndex(index, inList) ?
+                                   index->findByIcaoDesignators(CAircraftIcaoCode::null(), remoteAircraft.getAirlineIcaoCode()) :
+                                   inList.findByIcaoDesignators(CAircraftIcaoCode::null(), remoteAircraft.getAirlineIcaoCode()));
         if (
             mode.testFlag(CAircraftMatcherSetup::ByAirlineGroupSameAsAirline) ||
             (outList.isEmpty() || mode.testFlag(CAircraftMatcherSetup::ByAirlineGroupIfNoAirline)))
@@ -1919,7 +2162,7 @@ namespace BlackCore
         **/
     }
 
-    CAircraftModelList CAircraftMatcher::ifPossibleReduceByCombinedType(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &inList, const CAircraftMatcherSetup &setup, bool &reduced, CStatusMessageList *log)
+    CAircraftModelList CAircraftMatcher::ifPossibleReduceByCombinedType(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &inList, const CAircraftMatcherSetup &setup, bool &reduced, CStatusMessageList *log, const CAircraftModelSetIndex *index)
     {
         reduced = false;
         if (!remoteAircraft.getAircraftIcaoCode().hasValidCombinedType())
@@ -1929,7 +2172,7 @@ namespace BlackCore
         }
 
         const QString cc = remoteAircraft.getAircraftIcaoCode().getCombinedType();
-        CAircraftModelList modelsByCombinedCode(inList.findByCombinedType(cc));
+        CAircraftModelList modelsByCombinedCode(useIndex(index, inList) ? index->findByCombinedType(cc) : inList.findByCombinedType(cc));
         if (modelsByCombinedCode.isEmpty())
         {
             if (log) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, u"Not found by combined code " % cc, getLogCategories()); }
@@ -1939,8 +2182,8 @@ namespace BlackCore
         if (log) { CMatchingUtils::addLogDetailsToList(log, remoteAircraft, u"Found by combined code " % cc % u", possible " % QString::number(modelsByCombinedCode.size()), getLogCategories()); }
         if (modelsByCombinedCode.size() > 1)
         {
-            modelsByCombinedCode = ifPossibleReduceByAirline(remoteAircraft, modelsByCombinedCode, setup, QStringLiteral("Combined code airline reduction. "), reduced, log);
-            modelsByCombinedCode = ifPossibleReduceByManufacturer(remoteAircraft, modelsByCombinedCode, QStringLiteral("Combined code manufacturer reduction. "), reduced, log);
+            modelsByCombinedCode = ifPossibleReduceByAirline(remoteAircraft, modelsByCombinedCode, setup, QStringLiteral("Combined code airline reduction. "), reduced, log, index);
+            modelsByCombinedCode = ifPossibleReduceByManufacturer(remoteAircraft, modelsByCombinedCode, QStringLiteral("Combined code manufacturer reduction. "), reduced, log, index);
             reduced = true;
         }
         return modelsByCombinedCode;
@@ -16,19 +16,26 @@
 #include "blackmisc/simulation/aircraftmodelsetprovider.h"
 #include "blackmisc/simulation/aircraftmatchersetup.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/aircraftmodelsetindex.h"
 #include "blackmisc/simulation/matchingscriptmisc.h"
 #include "blackmisc/simulation/matchingstatistics.h"
 #include "blackmisc/simulation/matchinglog.h"
 #include "blackmisc/simulation/categorymatcher.h"
+#include "blackmisc/aviation/callsign.h"
 #include "blackmisc/statusmessage.h"
+#include "blackmisc/statusmessagelist.h"
 #include "blackmisc/valueobject.h"
 #include "blackmisc/variant.h"
 
+#include <QCache>
 #include <QFlags>
+#include <QMutex>
 #include <QObject>
 #include <QString>
 #include <QPair>
+#include <QReadWriteLock>
 #include <QSet>
+#include <atomic>
 
 namespace BlackMisc
 {
@@ -79,6 +86,7 @@ namespace BlackCore
         //! Get the closest matching aircraft model from set.
         //! Result depends on setup.
         //! \sa BlackMisc::Simulation::CAircraftMatcherSetup
+        //! \remark matches against a snapshot of model set and setup, so it can run in background threads
         //! \threadsafe
         BlackMisc::Simulation::CAircraftModel getClosestMatch(
             const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft,
@@ -293,11 +301,20 @@ namespace BlackCore
         //! Set default model, can be set by driver specific for simulator
         void setDefaultModel(const BlackMisc::Simulation::CAircraftModel &defaultModel);
 
-        //! The current statistics
-        const BlackMisc::Simulation::CMatchingStatistics &getCurrentStatistics() const { return m_statistics; }
+        //! Set the categories used for category matching
+        //! \remark by default the categories of the web data services
+        void setCategories(const BlackMisc::Aviation::CAircraftCategoryList &categories);
+
+        //! The current statistics, including the matching cache hits and misses
+        BlackMisc::Simulation::CMatchingStatistics getCurrentStatistics() const;
 
         //! Clear the statistics
-        void clearMatchingStatistics() { m_statistics.clear(); }
+        void clearMatchingStatistics();
+
+        //! Clear the cached matching results
+        //! \remark called whenever model set, setup or default model change
+        //! \threadsafe
+        void clearMatchingCache();
 
         //! Evaluate if a statistics entry makes sense and add it
         void evaluateStatisticsEntry(const QString &sessionId, const BlackMisc::Aviation::CCallsign &callsign, const QString &aircraftIcao, const QString &airlineIcao, const QString &livery);
@@ -317,7 +334,7 @@ namespace BlackCore
         static BlackMisc::Simulation::CAircraftModelList getClosestMatchStepwiseReduceImplementation(
             const BlackMisc::Simulation::CAircraftModelList &modelSet, const BlackMisc::Simulation::CAircraftMatcherSetup &setup,
             const BlackMisc::Simulation::CCategoryMatcher &categoryMatcher, const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft,
-            BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log = nullptr);
+            BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log = nullptr, const BlackMisc::Simulation::CAircraftModelSetIndex *index = nullptr);
 
         //! The score based implementation
         static BlackMisc::Simulation::CAircraftModelList getClosestMatchScoreImplementation(const BlackMisc::Simulation::CAircraftModelList &modelSet, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, int &maxScore, BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log = nullptr);
@@ -325,32 +342,32 @@ namespace BlackCore
         //! Get combined type default model, i.e. get a default model under consideration of the combined code such as "L2J"
         //! \see BlackMisc::Simulation::CSimulatedAircraft::getAircraftIcaoCombinedType
         //! \remark in any case a (default) model is returned
-        static BlackMisc::Simulation::CAircraftModel getCombinedTypeDefaultModel(const BlackMisc::Simulation::CAircraftModelList &modelSet, const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModel &defaultModel, BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log = nullptr);
+        static BlackMisc::Simulation::CAircraftModel getCombinedTypeDefaultModel(const BlackMisc::Simulation::CAircraftModelList &modelSet, const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModel &defaultModel, BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log = nullptr, const BlackMisc::Simulation::CAircraftModelSetIndex *index = nullptr);
 
         //! Search in models by key (aka model string)
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModel matchByExactModelString(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &models, BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log);
+        static BlackMisc::Simulation::CAircraftModel matchByExactModelString(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &models, BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log, const BlackMisc::Simulation::CAircraftModelSetIndex *index = nullptr);
 
         //! Installed models by ICAO data
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByIcaoData(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &models, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByIcaoData(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &models, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, bool &reduced, BlackMisc::CStatusMessageList *log, const BlackMisc::Simulation::CAircraftModelSetIndex *index = nullptr);
 
         //! Find model by aircraft family
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByFamily(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, bool allowPseudoFamily, const BlackMisc::Simulation::CAircraftModelList &inList, bool &reduced, QString &usedFamily, BlackMisc::CStatusMessageList *log);
+        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByFamily(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, bool allowPseudoFamily, const BlackMisc::Simulation::CAircraftModelList &inList, bool &reduced, QString &usedFamily, BlackMisc::CStatusMessageList *log, const BlackMisc::Simulation::CAircraftModelSetIndex *index = nullptr);
 
         //! Find model by aircraft family
         //! \remark pseudo family searches for same combined type and manufacturer
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByFamily(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const QString &family, bool allowPseudoFamily, const BlackMisc::Simulation::CAircraftModelList &inList, const QString &hint, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByFamily(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const QString &family, bool allowPseudoFamily, const BlackMisc::Simulation::CAircraftModelList &inList, const QString &hint, bool &reduced, BlackMisc::CStatusMessageList *log, const BlackMisc::Simulation::CAircraftModelSetIndex *index = nullptr);
 
         //! Search for exact livery and aircraft ICAO code
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByLiveryAndAircraftIcaoCode(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByLiveryAndAircraftIcaoCode(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, bool &reduced, BlackMisc::CStatusMessageList *log, const BlackMisc::Simulation::CAircraftModelSetIndex *index = nullptr);
 
         //! Reduce by manufacturer
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByManufacturer(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByManufacturer(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log, const BlackMisc::Simulation::CAircraftModelSetIndex *index = nullptr);
 
         //! Reduce by manufacturer
         //! \threadsafe
@@ -358,15 +375,15 @@ namespace BlackCore
 
         //! Reduce by aircraft ICAO
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByAircraft(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByAircraft(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log, const BlackMisc::Simulation::CAircraftModelSetIndex *index = nullptr);
 
         //! Reduce by aircraft ICAO or family
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByAircraftOrFamily(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, bool allowPseudoFamily, const BlackMisc::Simulation::CAircraftModelList &inList, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByAircraftOrFamily(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, bool allowPseudoFamily, const BlackMisc::Simulation::CAircraftModelList &inList, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log, const BlackMisc::Simulation::CAircraftModelSetIndex *index = nullptr);
 
         //! Reduce by airline ICAO
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByAirline(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByAirline(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, const QString &info, bool &reduced, BlackMisc::CStatusMessageList *log, const BlackMisc::Simulation::CAircraftModelSetIndex *index = nullptr);
 
         //! Reduce by airline name/telephone designator
         //! \threadsafe
@@ -374,7 +391,7 @@ namespace BlackCore
 
         //! Installed models by combined code (ie L2J, L1P, ...)
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByCombinedType(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, bool &reduced, BlackMisc::CStatusMessageList *log);
+        static BlackMisc::Simulation::CAircraftModelList ifPossibleReduceByCombinedType(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &inList, const BlackMisc::Simulation::CAircraftMatcherSetup &setup, bool &reduced, BlackMisc::CStatusMessageList *log, const BlackMisc::Simulation::CAircraftModelSetIndex *index = nullptr);
 
         //! By military flag
         //! \threadsafe
@@ -399,14 +416,59 @@ namespace BlackCore
         //! Use pseudo family
         static bool constexpr UsePseudoFamily = true;
 
+        //! Max. number of cached matching results
+        static int constexpr MatchingCacheSize = 1000;
+
+        //! Cached result of the matching steps for one aircraft/airline/livery/model string combination
+        struct MatchingCacheEntry
+        {
+            BlackMisc::Simulation::CAircraftModelList candidates;   //!< candidates to pick from
+            BlackMisc::Simulation::CAircraftModel     defaultModel; //!< combined type default model if there are no candidates
+            BlackMisc::CStatusMessageList             log;          //!< log of the matching steps, if logged
+            BlackMisc::Aviation::CCallsign            callsign;     //!< callsign the log has been written for
+            BlackMisc::Simulation::MatchingLog        whatToLog = BlackMisc::Simulation::MatchingLogNothing; //!< what has been logged
+        };
+
+        //! Model set without the models excluded by the setup, with its index
+        struct MatchingModelSet
+        {
+            BlackMisc::Simulation::CAircraftModelList     models;            //!< models matched against
+            BlackMisc::Simulation::CAircraftModelSetIndex index;             //!< index of models
+            int                                           noModelString = 0; //!< excluded models without model string
+            int                                           noDbKey = 0;       //!< excluded models without DB key
+            int                                           excluded = 0;      //!< excluded models marked 'Excluded'
+        };
+
+        //! Set model set and indexes used for matching
+        void setMatchingModelSet(const BlackMisc::Simulation::CAircraftModelList &modelSet);
+
+        //! Model set without the models excluded by setup
+        //! \remark modelSetIndex is reused if no model is excluded
+        static MatchingModelSet matchingModelSet(const BlackMisc::Simulation::CAircraftModelList &modelSet, const BlackMisc::Simulation::CAircraftModelSetIndex &modelSetIndex, const BlackMisc::Simulation::CAircraftMatcherSetup &setup);
+
+        //! Key of the matching cache, all values of the remote aircraft the matching steps depend on
+        static QString matchingCacheKey(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft);
+
+        //! Log of a cached matching result with the callsign of the aircraft it has been written for replaced
+        static BlackMisc::CStatusMessageList replaceLogCallsign(const BlackMisc::CStatusMessageList &log, const BlackMisc::Aviation::CCallsign &from, const BlackMisc::Aviation::CCallsign &to);
+
         BlackMisc::Simulation::CAircraftMatcherSetup m_setup;           //!< setup
         BlackMisc::Simulation::CAircraftModel        m_defaultModel;    //!< model to be used as default model
         BlackMisc::Simulation::CAircraftModelList    m_modelSet;        //!< models used for model matching
+        BlackMisc::Simulation::CAircraftModelSetIndex m_modelSetIndex;  //!< index of m_modelSet, rebuilt whenever m_modelSet changes
+        MatchingModelSet                             m_matchingModelSet; //!< m_modelSet without excluded models, rebuilt whenever m_modelSet or the exclusions change
         BlackMisc::Simulation::CAircraftModelList    m_disabledModels;  //!< disabled models for matching
         BlackMisc::Simulation::CSimulatorInfo        m_simulator;       //!< simulator (optional)
         BlackMisc::Simulation::CMatchingStatistics   m_statistics;      //!< matching statistics
         BlackMisc::Simulation::CCategoryMatcher      m_categoryMatcher; //!< the category matcher
         QString                                      m_modelSetInfo;    //!< info string
+
+        mutable QReadWriteLock m_lockMatching; //!< lock for model set, index, setup and default model as read by getClosestMatch
+        mutable QMutex m_matchingCacheMutex; //!< lock for cache and version
+        mutable QCache<QString, MatchingCacheEntry> m_matchingCache { MatchingCacheSize }; //!< LRU cache of matching results
+        int m_matchingCacheVersion = 0;                    //!< incremented when the cache is cleared, results of older versions are not cached
+        mutable std::atomic_int m_matchingCacheHits   { 0 }; //!< matches taken from the cache
+        mutable std::atomic_int m_matchingCacheMisses { 0 }; //!< matches calculated
     };
 } // namespace
 
@@ -0,0 +1,230 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackcore/aircraftmatchingqueue.h"
+#include "blackcore/aircraftmatcher.h"
+#include "blackmisc/simulation/simulatedaircraftlist.h"
+#include "blackmisc/pq/units.h"
+
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QThread>
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+
+namespace BlackCore
+{
+    CAircraftMatchingWorker::CAircraftMatchingWorker(const CAircraftMatcher &matcher, CAircraftMatchingQueue *queue) :
+        CContinuousWorker(queue, "matching"), m_matcher(matcher), m_queue(queue)
+    {
+        this->setObjectName("CAircraftMatchingWorker");
+    }
+
+    void CAircraftMatchingWorker::matchInBackground(const CSimulatedAircraft &remoteAircraft, MatchingLog whatToLog, quint64 job, qint64 queuedMsSinceEpoch)
+    {
+        QPointer<CAircraftMatchingWorker> myself(this);
+        QMetaObject::invokeMethod(this, [ = ]
+        {
+            CAircraftMatchingQueue::MatchingResult result;
+            result.remoteAircraft = remoteAircraft;
+
+            QElapsedTimer time;
+            time.start();
+            CStatusMessageList *log = whatToLog > 0 ? &result.messages : nullptr;
+            result.model = m_matcher.getClosestMatch(remoteAircraft, whatToLog, log, true);
+            result.matchingMs = time.elapsed();
+
+            // queue deleted: posted call is discarded
+            CAircraftMatchingQueue *queue = m_queue;
+            QMetaObject::invokeMethod(queue, [ = ] { queue->onMatched(result, job, queuedMsSinceEpoch, myself); });
+        });
+    }
+
+    CAircraftMatchingQueue::CAircraftMatchingQueue(const CAircraftMatcher &matcher, QObject *parent) :
+        QObject(parent), m_matcher(matcher)
+    {
+        this->setObjectName("CAircraftMatchingQueue");
+        m_maxParallel = qMax(1, QThread::idealThreadCount() - 1);
+        m_deliverTimer.setSingleShot(true);
+        m_deliverTimer.setInterval(DeliverBatchMs);
+        m_deliverTimer.setObjectName(this->objectName() + ":deliverTimer");
+        connect(&m_deliverTimer, &QTimer::timeout, this, &CAircraftMatchingQueue::deliverResults);
+    }
+
+    CAircraftMatchingQueue::~CAircraftMatchingQueue()
+    {
+        // the workers refer to the matcher
+        for (const QPointer<CAircraftMatchingWorker> &worker : std::as_const(m_workers))
+        {
+            if (worker) { worker->quitAndWait(); }
+        }
+    }
+
+    void CAircraftMatchingQueue::enqueue(const CSimulatedAircraft &remoteAircraft, MatchingLog whatToLog)
+    {
+        const CCallsign callsign = remoteAircraft.getCallsign();
+        this->remove(callsign);
+        m_pending.push_back({ remoteAircraft, whatToLog, QDateTime::currentMSecsSinceEpoch() });
+        m_maxQueueDepth = qMax(m_maxQueueDepth, m_pending.size());
+        this->startMatchings();
+    }
+
+    void CAircraftMatchingQueue::remove(const CCallsign &callsign)
+    {
+        m_running.remove(callsign);
+        m_pending.erase(std::remove_if(m_pending.begin(), m_pending.end(), [&](const Pending &p) { return p.remoteAircraft.getCallsign() == callsign; }), m_pending.end());
+        m_results.erase(std::remove_if(m_results.begin(), m_results.end(), [&](const MatchingResult &r) { return r.remoteAircraft.getCallsign() == callsign; }), m_results.end());
+    }
+
+    void CAircraftMatchingQueue::clear()
+    {
+        m_running.clear();
+        m_pending.clear();
+        m_results.clear();
+        m_deliverTimer.stop();
+    }
+
+    void CAircraftMatchingQueue::setMaxParallelMatchings(int maxParallel)
+    {
+        m_maxParallel = qMax(1, maxParallel);
+        this->shrinkWorkers();
+        this->startMatchings();
+    }
+
+    QString CAircraftMatchingQueue::getStatisticsInfo() const
+    {
+        return QStringLiteral("Matching queue: %1 waiting (max. %2), %3 running (max. %4), %5 matched, latency avg. %6ms max. %7ms last %8ms, matching avg. %9ms").
+               arg(this->getQueueDepth()).arg(this->getMaxQueueDepth()).
+               arg(this->getRunningMatchings()).arg(this->getMaxParallelMatchings()).
+               arg(this->getMatchedCount()).
+               arg(this->getAverageLatencyMs()).arg(this->getMaxLatencyMs()).arg(this->getLastLatencyMs()).
+               arg(this->getAverageMatchingMs());
+    }
+
+    void CAircraftMatchingQueue::resetStatistics()
+    {
+        m_maxQueueDepth = m_pending.size();
+        m_matchedCount  = 0;
+        m_lastLatencyMs = 0;
+        m_maxLatencyMs  = 0;
+        m_sumLatencyMs  = 0;
+        m_sumMatchingMs = 0;
+    }
+
+    void CAircraftMatchingQueue::startMatchings()
+    {
+        while (m_runningCount < m_maxParallel && !m_pending.isEmpty())
+        {
+            CAircraftMatchingWorker *worker = this->idleWorker();
+            if (!worker) { break; }
+
+            const Pending pending = m_pending.takeAt(this->closestPendingIndex());
+            const quint64 job = ++m_nextJob;
+            m_running.insert(pending.remoteAircraft.getCallsign(), job);
+            m_runningCount++;
+            worker->matchInBackground(pending.remoteAircraft, pending.whatToLog, job, pending.queuedMsSinceEpoch);
+        }
+    }
+
+    int CAircraftMatchingQueue::closestPendingIndex()
+    {
+        if (m_pending.size() < 2 || !this->getRemoteAircraftProvider()) { return 0; }
+
+        // same distances the airspace snapshot is sorted by, taken once for all starts within DistancesMaxAgeMs
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        if (m_distancesMsSinceEpoch < 0 || now - m_distancesMsSinceEpoch > DistancesMaxAgeMs)
+        {
+            m_distances.clear();
+            const CSimulatedAircraftList aircraft = this->getAircraftInRange();
+            for (const CSimulatedAircraft &a : aircraft)
+            {
+                if (a.getRelativeDistance().isNull()) { continue; }
+                m_distances.insert(a.getCallsign(), a.getRelativeDistance().value(CLengthUnit::m()));
+            }
+            m_distancesMsSinceEpoch = now;
+        }
+
+        // unknown distances last, otherwise first come first served
+        int closest = 0;
+        double closestDistance = std::numeric_limits<double>::max();
+        for (int i = 0; i < m_pending.size(); ++i)
+        {
+            const double d = m_distances.value(m_pending[i].remoteAircraft.getCallsign(), std::numeric_limits<double>::max());
+            if (d < closestDistance)
+            {
+                closest = i;
+                closestDistance = d;
+            }
+        }
+        return closest;
+    }
+
+    CAircraftMatchingWorker *CAircraftMatchingQueue::idleWorker()
+    {
+        m_workers.removeAll(nullptr);
+        m_idleWorkers.removeAll(nullptr);
+        if (!m_idleWorkers.isEmpty()) { return m_idleWorkers.takeLast(); }
+        if (m_workers.size() >= m_maxParallel) { return nullptr; }
+
+        CAircraftMatchingWorker *worker = new CAircraftMatchingWorker(m_matcher, this);
+        worker->start(QThread::LowPriority);
+        m_workers.push_back(worker);
+        return worker;
+    }
+
+    void CAircraftMatchingQueue::shrinkWorkers()
+    {
+        m_workers.removeAll(nullptr);
+        m_idleWorkers.removeAll(nullptr);
+        while (m_workers.size() > m_maxParallel && !m_idleWorkers.isEmpty())
+        {
+            const QPointer<CAircraftMatchingWorker> worker = m_idleWorkers.takeLast();
+            m_workers.removeAll(worker);
+            worker->quit();
+        }
+    }
+
+    void CAircraftMatchingQueue::onMatched(const MatchingResult &result, quint64 job, qint64 queuedMsSinceEpoch, CAircraftMatchingWorker *worker)
+    {
+        m_runningCount--;
+        if (worker) { m_idleWorkers.push_back(worker); }
+        this->shrinkWorkers();
+        const CCallsign callsign = result.remoteAircraft.getCallsign();
+        if (m_running.value(callsign) == job)
+        {
+            m_running.remove(callsign);
+
+            MatchingResult matched(result);
+            matched.latencyMs = QDateTime::currentMSecsSinceEpoch() - queuedMsSinceEpoch;
+            m_matchedCount++;
+            m_lastLatencyMs = matched.latencyMs;
+            m_maxLatencyMs  = qMax(m_maxLatencyMs, matched.latencyMs);
+            m_sumLatencyMs  += matched.latencyMs;
+            m_sumMatchingMs += matched.matchingMs;
+
+            m_results.push_back(matched);
+            if (!m_deliverTimer.isActive()) { m_deliverTimer.start(); }
+        }
+        this->startMatchings();
+    }
+
+    void CAircraftMatchingQueue::deliverResults()
+    {
+        if (m_results.isEmpty()) { return; }
+        MatchingResults results;
+        results.swap(m_results);
+        emit this->aircraftMatched(results);
+    }
+} // ns
@@ -0,0 +1,180 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKCORE_AIRCRAFTMATCHINGQUEUE_H
+#define BLACKCORE_AIRCRAFTMATCHINGQUEUE_H
+
+#include "blackcore/blackcoreexport.h"
+#include "blackmisc/simulation/remoteaircraftprovider.h"
+#include "blackmisc/simulation/simulatedaircraft.h"
+#include "blackmisc/simulation/aircraftmodel.h"
+#include "blackmisc/simulation/matchinglog.h"
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/statusmessagelist.h"
+#include "blackmisc/worker.h"
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QTimer>
+#include <QVector>
+#include <QtGlobal>
+
+namespace BlackCore
+{
+    class CAircraftMatcher;
+    class CAircraftMatchingQueue;
+
+    //! Worker thread of CAircraftMatchingQueue, matches one aircraft after the other
+    class BLACKCORE_EXPORT CAircraftMatchingWorker : public BlackMisc::CContinuousWorker
+    {
+        Q_OBJECT
+
+    public:
+        //! Constructor
+        CAircraftMatchingWorker(const CAircraftMatcher &matcher, CAircraftMatchingQueue *queue);
+
+        //! Match in the worker thread, the result is passed to the queue in the queue's thread
+        //! \threadsafe
+        void matchInBackground(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, BlackMisc::Simulation::MatchingLog whatToLog, quint64 job, qint64 queuedMsSinceEpoch);
+
+    private:
+        const CAircraftMatcher &m_matcher;
+        CAircraftMatchingQueue *m_queue = nullptr;
+    };
+
+    //! Queue matching remote aircraft in background threads
+    //! \remark Matchings run in a pool of at most getMaxParallelMatchings worker threads, which are reused
+    //! \remark Waiting aircraft are matched closest first. Results are delivered in the thread of the queue,
+    //!         collected in batches, so a burst of new aircraft does not wait for one match after the other.
+    class BLACKCORE_EXPORT CAircraftMatchingQueue :
+        public QObject,
+        public BlackMisc::Simulation::CRemoteAircraftAware
+    {
+        Q_OBJECT
+
+    public:
+        //! Result of matching one aircraft
+        struct MatchingResult
+        {
+            BlackMisc::Simulation::CSimulatedAircraft remoteAircraft; //!< aircraft as queued
+            BlackMisc::Simulation::CAircraftModel     model;          //!< matched model
+            BlackMisc::CStatusMessageList             messages;       //!< matching log, empty if not logged
+            qint64 latencyMs  = 0; //!< from queued to matched
+            qint64 matchingMs = 0; //!< matching only
+        };
+
+        //! Matching results
+        using MatchingResults = QVector<MatchingResult>;
+
+        //! Time results are collected before they are delivered
+        static constexpr int DeliverBatchMs = 25;
+
+        //! Time the distances of the aircraft in range are used to pick the closest waiting aircraft
+        static constexpr int DistancesMaxAgeMs = 1000;
+
+        //! Constructor
+        //! \remark matcher must outlive the queue
+        //! \remark without remote aircraft provider aircraft are matched first come first served,
+        //!         the provider can be set later by setRemoteAircraftProvider
+        CAircraftMatchingQueue(const CAircraftMatcher &matcher, QObject *parent);
+
+        //! Destructor, waits for running matchings
+        virtual ~CAircraftMatchingQueue() override;
+
+        //! Queue aircraft for matching
+        //! \remark replaces a waiting or running matching of the same callsign
+        void enqueue(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, BlackMisc::Simulation::MatchingLog whatToLog);
+
+        //! Remove an aircraft, a running matching of it is discarded
+        void remove(const BlackMisc::Aviation::CCallsign &callsign);
+
+        //! Remove all aircraft, running matchings are discarded
+        void clear();
+
+        //! Max. number of matchings running in parallel
+        //! @{
+        int getMaxParallelMatchings() const { return m_maxParallel; }
+        void setMaxParallelMatchings(int maxParallel);
+        //! @}
+
+        //! Instrumentation
+        //! @{
+        int getQueueDepth() const { return m_pending.size(); }
+        int getMaxQueueDepth() const { return m_maxQueueDepth; }
+        int getRunningMatchings() const { return m_runningCount; }
+        int getMatchedCount() const { return m_matchedCount; }
+        qint64 getLastLatencyMs() const { return m_lastLatencyMs; }
+        qint64 getMaxLatencyMs() const { return m_maxLatencyMs; }
+        qint64 getAverageLatencyMs() const { return m_matchedCount > 0 ? m_sumLatencyMs / m_matchedCount : 0; }
+        qint64 getAverageMatchingMs() const { return m_matchedCount > 0 ? m_sumMatchingMs / m_matchedCount : 0; }
+        QString getStatisticsInfo() const;
+        void resetStatistics();
+        //! @}
+
+    signals:
+        //! Aircraft have been matched
+        void aircraftMatched(const BlackCore::CAircraftMatchingQueue::MatchingResults &results);
+
+    private:
+        friend class CAircraftMatchingWorker;
+
+        //! Aircraft waiting for matching
+        struct Pending
+        {
+            BlackMisc::Simulation::CSimulatedAircraft remoteAircraft; //!< aircraft
+            BlackMisc::Simulation::MatchingLog whatToLog;             //!< log flags
+            qint64 queuedMsSinceEpoch = 0;                            //!< when queued
+        };
+
+        //! Start matchings up to the max. parallel matchings
+        void startMatchings();
+
+        //! Index of the closest waiting aircraft
+        int closestPendingIndex();
+
+        //! Idle worker, a new one if there is none and the pool is not full
+        CAircraftMatchingWorker *idleWorker();
+
+        //! Quit idle workers exceeding the max. parallel matchings
+        void shrinkWorkers();
+
+        //! Matching finished
+        void onMatched(const MatchingResult &result, quint64 job, qint64 queuedMsSinceEpoch, CAircraftMatchingWorker *worker);
+
+        //! Deliver the collected results
+        void deliverResults();
+
+        const CAircraftMatcher &m_matcher;
+        QList<Pending> m_pending;                      //!< waiting aircraft
+        QHash<BlackMisc::Aviation::CCallsign, quint64> m_running; //!< callsign and job of running matchings, results of other jobs are discarded
+        QList<QPointer<CAircraftMatchingWorker>> m_workers;     //!< worker pool
+        QList<QPointer<CAircraftMatchingWorker>> m_idleWorkers; //!< workers of the pool not matching
+        QHash<BlackMisc::Aviation::CCallsign, double> m_distances; //!< distances of the aircraft in range (m)
+        qint64 m_distancesMsSinceEpoch = -1;                       //!< when m_distances have been taken
+        MatchingResults m_results;                     //!< results not yet delivered
+        QTimer m_deliverTimer;                         //!< delivers results in batches
+        quint64 m_nextJob = 0;
+        int m_maxParallel = 1;
+        int m_runningCount = 0;
+
+        // instrumentation
+        int m_maxQueueDepth = 0;
+        int m_matchedCount = 0;
+        qint64 m_lastLatencyMs = 0;
+        qint64 m_maxLatencyMs = 0;
+        qint64 m_sumLatencyMs = 0;
+        qint64 m_sumMatchingMs = 0;
+    };
+} // ns
+
+#endif // guard
@@ -11,6 +11,7 @@
 #include "blackmisc/aviation/aircraftsituation.h"
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/aviation/transponder.h"
+#include "blackmisc/geo/coordinategeodetic.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/simulation/simulatedaircraftlist.h"
 #include "blackmisc/statusmessage.h"
@@ -237,8 +238,15 @@ namespace BlackCore
         // nevertheless we calculate all the time as the snapshot could be used in other scenarios
 
         CSimulatedAircraftList aircraftInRange(this->getAircraftInRange()); // thread safe copy from provider
+
+        // distances are only updated when a remote aircraft moves, so update them for all aircraft in one pass
+        const CCoordinateGeodetic ownPosition = this->getOwnAircraftPosition();
+        if (!ownPosition.isNull()) { aircraftInRange.calculcateAndUpdateRelativeDistance(ownPosition); }
+
+        // only aircraft changing their order are ranked again, the snapshot contains the changes of the enabled aircraft
+        const CAirspaceAircraftSnapshot previous = this->getLatestAirspaceAircraftSnapshot();
         CAirspaceAircraftSnapshot snapshot(
-            aircraftInRange,
+            aircraftInRange, previous,
             restricted, enabled,
             maxAircraft, maxRenderedDistance
         );
@@ -1018,6 +1018,36 @@ namespace BlackCore::Context
         return m_airspace->partsLastModified(callsign);
     }
 
+    CAircraftSituationList CContextNetwork::remoteAircraftSituations(CCallsignId callsignId) const
+    {
+        if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
+        return m_airspace->remoteAircraftSituations(callsignId);
+    }
+
+    CAircraftPartsList CContextNetwork::remoteAircraftParts(CCallsignId callsignId) const
+    {
+        if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
+        return m_airspace->remoteAircraftParts(callsignId);
+    }
+
+    CAircraftSituationChangeList CContextNetwork::remoteAircraftSituationChanges(CCallsignId callsignId) const
+    {
+        if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
+        return m_airspace->remoteAircraftSituationChanges(callsignId);
+    }
+
+    qint64 CContextNetwork::situationsLastModified(CCallsignId callsignId) const
+    {
+        if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
+        return m_airspace->situationsLastModified(callsignId);
+    }
+
+    qint64 CContextNetwork::partsLastModified(CCallsignId callsignId) const
+    {
+        if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
+        return m_airspace->partsLastModified(callsignId);
+    }
+
     QString CContextNetwork::getNetworkStatistics(bool reset, const QString &separator)
     {
         if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
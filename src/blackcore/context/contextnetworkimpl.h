@@ -198,6 +198,11 @@ namespace BlackCore
             virtual int aircraftPartsAdded() const override;
             virtual qint64 situationsLastModified(const BlackMisc::Aviation::CCallsign &callsign) const override;
             virtual qint64 partsLastModified(const BlackMisc::Aviation::CCallsign &callsign) const override;
+            virtual BlackMisc::Aviation::CAircraftSituationList remoteAircraftSituations(BlackMisc::Aviation::CCallsignId callsignId) const override;
+            virtual BlackMisc::Aviation::CAircraftPartsList remoteAircraftParts(BlackMisc::Aviation::CCallsignId callsignId) const override;
+            virtual BlackMisc::Aviation::CAircraftSituationChangeList remoteAircraftSituationChanges(BlackMisc::Aviation::CCallsignId callsignId) const override;
+            virtual qint64 situationsLastModified(BlackMisc::Aviation::CCallsignId callsignId) const override;
+            virtual qint64 partsLastModified(BlackMisc::Aviation::CCallsignId callsignId) const override;
             virtual QString getNetworkStatistics(bool reset, const QString &separator) override;
             virtual bool setNetworkStatisticsEnable(bool enabled) override;
             virtual bool testAddAltitudeOffset(const BlackMisc::Aviation::CCallsign &callsign, const BlackMisc::PhysicalQuantities::CLength &offset = BlackMisc::PhysicalQuantities::CLength::null()) override;
@@ -75,6 +75,7 @@ namespace BlackCore::Context
 
         connect(&m_weatherManager,  &CWeatherManager::weatherGridReceived, this, &CContextSimulator::onWeatherGridReceived, Qt::QueuedConnection);
         connect(&m_aircraftMatcher, &CAircraftMatcher::setupChanged,       this, &CContextSimulator::matchingSetupChanged);
+        connect(&m_matchingQueue,   &CAircraftMatchingQueue::aircraftMatched, this, &CContextSimulator::onAircraftMatched);
         connect(&CCentralMultiSimulatorModelSetCachesProvider::modelCachesInstance(), &CCentralMultiSimulatorModelSetCachesProvider::cacheChanged, this, &CContextSimulator::modelSetChanged);
 
         // deferred init of last model set, if no other data are set in meantime
@@ -487,6 +488,7 @@ namespace BlackCore::Context
         Q_ASSERT_X(simulator, Q_FUNC_INFO, "no simulator driver can be created");
 
         this->setRemoteAircraftProvider(renderedAircraftProvider);
+        m_matchingQueue.setRemoteAircraftProvider(renderedAircraftProvider);
 
         // use simulator info from ISimulator as it can access the emulated driver settings
         CSimulatorInfo simInfo = simulator->getSimulatorInfo();
@@ -656,6 +658,7 @@ namespace BlackCore::Context
 
             m_simulatorPlugin.second = nullptr;
             m_simulatorPlugin.first = CSimulatorPluginInfo();
+            m_matchingQueue.clear();
 
             Q_ASSERT(this->getIContextNetwork());
             Q_ASSERT(this->getIContextNetwork()->isLocalObject());
@@ -687,10 +690,26 @@ namespace BlackCore::Context
         // here we find the best simulator model for a resolved model
         // in the first step we already tried to find accurate ICAO codes etc.
         // coming from CAirspaceMonitor::sendReadyForModelMatching
-        MatchingLog whatToLog = m_logMatchingMessages;
-        CStatusMessageList matchingMessages;
+        // matching runs in background, closest aircraft first, see onAircraftMatched
+        m_matchingQueue.enqueue(remoteAircraft, m_logMatchingMessages);
+    }
+
+    void CContextSimulator::onAircraftMatched(const CAircraftMatchingQueue::MatchingResults &results)
+    {
+        for (const CAircraftMatchingQueue::MatchingResult &result : results)
+        {
+            if (!this->isSimulatorPluginAvailable()) { return; }
+            this->addMatchedRemoteAircraft(result);
+        }
+    }
+
+    void CContextSimulator::addMatchedRemoteAircraft(const CAircraftMatchingQueue::MatchingResult &result)
+    {
+        const CSimulatedAircraft &remoteAircraft = result.remoteAircraft;
+        const CCallsign callsign = remoteAircraft.getCallsign();
+        CStatusMessageList matchingMessages = result.messages;
         CStatusMessageList *pMatchingMessages = m_logMatchingMessages > 0 ? &matchingMessages : nullptr;
-        CAircraftModel aircraftModel = m_aircraftMatcher.getClosestMatch(remoteAircraft, whatToLog, pMatchingMessages, true);
+        CAircraftModel aircraftModel = result.model;
         Q_ASSERT_X(remoteAircraft.getCallsign() == aircraftModel.getCallsign(), Q_FUNC_INFO, "Mismatching callsigns");
 
         // decide CG
@@ -749,6 +768,7 @@ namespace BlackCore::Context
 
     void CContextSimulator::xCtxRemovedRemoteAircraft(const CCallsign &callsign)
     {
+        m_matchingQueue.remove(callsign);
         if (!this->isSimulatorAvailable()) { return; }
         m_simulatorPlugin.second->logicallyRemoveRemoteAircraft(callsign);
         m_failoverAddingCounts.remove(callsign);
@@ -838,6 +858,7 @@ namespace BlackCore::Context
         else if (to.isDisconnected())
         {
             m_networkSessionId.clear();
+            m_matchingQueue.clear();
             m_aircraftMatcher.clearMatchingStatistics();
             m_matchingMessages.clear();
             m_failoverAddingCounts.clear();
@@ -1078,7 +1099,8 @@ namespace BlackCore::Context
         CSimpleCommandParser parser(
         {
             ".plugin", ".drv", ".driver", // forwarded to driver
-            ".ris" // rendering interpolator setup
+            ".ris", // rendering interpolator setup
+            ".matchingqueue" // background model matching
         });
         parser.parse(commandLine);
         if (!parser.isKnownCommand()) { return false; }
@@ -1103,6 +1125,20 @@ namespace BlackCore::Context
             CLogMessage(this, CLogCategories::cmdLine()).info(u"Setup is: '%1'") << rs.toQString(true);
             return true;
         }
+        if (parser.matchesCommand("matchingqueue"))
+        {
+            if (parser.part(1) == "reset")
+            {
+                m_matchingQueue.resetStatistics();
+                CLogMessage(this, CLogCategories::cmdLine()).info(u"Reset matching queue statistics");
+                return true;
+            }
+            if (this->getIContextApplication())
+            {
+                emit this->getIContextApplication()->requestDisplayOnConsole(m_matchingQueue.getStatisticsInfo());
+            }
+            return true;
+        }
         if (parser.matchesCommand("plugin") || parser.matchesCommand("drv") || parser.matchesCommand("driver"))
         {
             if (!m_simulatorPlugin.second) { return false; }
@@ -16,6 +16,7 @@
 #include "blackcore/simulator.h"
 #include "blackcore/corefacadeconfig.h"
 #include "blackcore/aircraftmatcher.h"
+#include "blackcore/aircraftmatchingqueue.h"
 #include "blackcore/blackcoreexport.h"
 #include "blackcore/weathermanager.h"
 #include "blackmisc/network/connectionstatus.h"
@@ -172,6 +173,8 @@ namespace BlackCore
                 BlackMisc::CSimpleCommandParser::registerCommand({".ris show", "display rendering/interpolation setup on console (global setup)"});
                 BlackMisc::CSimpleCommandParser::registerCommand({".ris debug on|off", "rendering/interpolation debug messages (global setup)"});
                 BlackMisc::CSimpleCommandParser::registerCommand({".ris parts on|off", "aircraft parts (global setup)"});
+                BlackMisc::CSimpleCommandParser::registerCommand({".matchingqueue", "display model matching queue statistics on console"});
+                BlackMisc::CSimpleCommandParser::registerCommand({".matchingqueue reset", "reset model matching queue statistics"});
             }
 
         protected:
@@ -233,6 +236,12 @@ namespace BlackCore
             //! Simulator model has been changed
             void onOwnSimulatorModelChanged(const BlackMisc::Simulation::CAircraftModel &model);
 
+            //! Remote aircraft have been matched in background
+            void onAircraftMatched(const CAircraftMatchingQueue::MatchingResults &results);
+
+            //! Apply matched model and add aircraft to simulator
+            void addMatchedRemoteAircraft(const CAircraftMatchingQueue::MatchingResult &result);
+
             //! Failed adding remote aircraft
             void onAddingRemoteAircraftFailed(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, bool disabled, bool requestFailover, const BlackMisc::CStatusMessage &message);
 
@@ -285,6 +294,7 @@ namespace BlackCore
             BlackMisc::CRegularThread m_listenersThread;   //!< waiting for plugin
             CWeatherManager  m_weatherManager  { this };   //!< weather management
             CAircraftMatcher m_aircraftMatcher { this };   //!< model matcher
+            CAircraftMatchingQueue m_matchingQueue { m_aircraftMatcher, this }; //!< matches in background
 
             bool m_wasSimulating          = false;
             bool m_initallyAddAircraft    = false;
@@ -13,6 +13,7 @@
 
 #include "blackmisc/datacache.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/aircraftmodellistbinary.h"
 #include "blackmisc/simulation/distributorlist.h"
 #include "blackmisc/aviation/airlineicaocodelist.h"
 #include "blackmisc/aviation/aircrafticaocodelist.h"
@@ -33,6 +34,15 @@ namespace BlackCore::Data
         //! Defer loading
         static constexpr bool isDeferred() { return true; }
 
+        //! Binary file, the DB models are a large list
+        static constexpr bool isBinary() { return true; }
+
+        //! \copydoc BlackMisc::TDataTrait::toBinary
+        static QByteArray toBinary(const BlackMisc::Simulation::CAircraftModelList &models) { return BlackMisc::Simulation::CAircraftModelListBinary::toBinary(models); }
+
+        //! \copydoc BlackMisc::TDataTrait::fromBinary
+        static BlackMisc::Simulation::CAircraftModelList fromBinary(const QByteArray &data, BlackMisc::CStatusMessage &o_status) { return BlackMisc::Simulation::CAircraftModelListBinary::fromBinary(data, o_status); }
+
         //! Key in data cache
         static const char *key() { return "dbmodelcache"; }
     };
@@ -20,6 +20,7 @@
 
 using namespace BlackMisc;
 using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
 using namespace BlackMisc::Network;
 using namespace BlackMisc::Db;
 
@@ -51,6 +52,19 @@ namespace BlackCore::Db
         return this->getAirports().size();
     }
 
+    CAirportList CAirportDataReader::getAirportsClosest(int number, const ICoordinateGeodetic &position) const
+    {
+        return this->getAirportIndex().findClosest(number, position);
+    }
+
+    CGeoObjectIndex<CAirportList> CAirportDataReader::getAirportIndex() const
+    {
+        const CAirportList airports = this->getAirports();
+        QMutexLocker l(&m_airportIndexMutex);
+        if (!m_airportIndex.isIndexOf(airports)) { m_airportIndex = CGeoObjectIndex<CAirportList>(airports); }
+        return m_airportIndex;
+    }
+
     bool CAirportDataReader::readFromJsonFilesInBackground(const QString &dir, CEntityFlags::Entity whatToRead, bool overrideNewerOnly)
     {
         if (dir.isEmpty() || whatToRead == CEntityFlags::NoEntity) { return false; }
@@ -209,7 +223,11 @@ namespace BlackCore::Db
             const CAirportList incrementalAirports(CAirportList::fromDatabaseJson(res, &inconsistent));
             if (incrementalAirports.isEmpty()) { return; } // currently ignored
             airports = this->getAirports();
-            airports.replaceOrAddObjectsByKey(incrementalAirports);
+            int updated = 0;
+            int added = 0;
+            int removed = 0;
+            airports.replaceOrAddObjectsByKey(incrementalAirports, &updated, &added, &removed);
+            this->logMergeMessage("airports", incrementalAirports.size(), updated, added, removed, res);
         }
         else
         {
@@ -15,8 +15,10 @@
 #include "blackcore/data/dbcaches.h"
 #include "blackcore/db/databasereader.h"
 #include "blackmisc/aviation/airportlist.h"
+#include "blackmisc/geo/geoobjectindex.h"
 #include "blackmisc/network/entityflags.h"
 
+#include <QMutex>
 #include <QNetworkAccessManager>
 #include <atomic>
 
@@ -47,6 +49,10 @@ namespace BlackCore::Db
         //! \threadsafe
         int getAirportsCount() const;
 
+        //! Closest airports, closest first
+        //! \threadsafe
+        BlackMisc::Aviation::CAirportList getAirportsClosest(int number, const BlackMisc::Geo::ICoordinateGeodetic &position) const;
+
         // data read from local data
         virtual BlackMisc::CStatusMessageList readFromJsonFiles(const QString &dir, BlackMisc::Network::CEntityFlags::Entity whatToRead, bool overrideNewerOnly) override;
         virtual bool readFromJsonFilesInBackground(const QString &dir, BlackMisc::Network::CEntityFlags::Entity whatToRead, bool overrideNewerOnly) override;
@@ -70,6 +76,13 @@ namespace BlackCore::Db
         BlackMisc::CData<BlackCore::Data::TDbAirportCache> m_airportCache {this, &CAirportDataReader::airportCacheChanged}; //!< cache file
         std::atomic_bool m_syncedAirportCache { false }; //!< already synchronized?
 
+        mutable BlackMisc::Geo::CGeoObjectIndex<BlackMisc::Aviation::CAirportList> m_airportIndex; //!< built when first used after airports changed
+        mutable QMutex m_airportIndexMutex; //!< lock m_airportIndex
+
+        //! Spatial index of the current airports
+        //! \threadsafe
+        BlackMisc::Geo::CGeoObjectIndex<BlackMisc::Aviation::CAirportList> getAirportIndex() const;
+
         //! Reader URL (we read from where?) used to detect changes of location
         BlackMisc::CData<BlackCore::Data::TDbModelReaderBaseUrl> m_readerUrlCache {this, &CAirportDataReader::baseUrlCacheChanged };
 
@@ -239,7 +239,8 @@ namespace BlackCore::Db
         const bool ok = this->setHeaderInfoPart(datastoreResponse, nwReply);
         if (ok)
         {
-            const QString dataFileData = nwReply->readAll();
+            // kept as UTF-8, uncompressed JSON is parsed without a UTF-16 copy
+            const QByteArray dataFileData = nwReply->readAll();
             nwReply->close(); // close asap
             datastoreResponse.setStringSize(dataFileData.size());
             if (dataFileData.isEmpty())
@@ -677,6 +678,21 @@ namespace BlackCore::Db
                 << CThreadUtils::currentThreadInfo() << response.toQString();
     }
 
+    void CDatabaseReader::logMergeMessage(const QString &entity, int size, int updated, int added, int removed, const CDatabaseReader::JsonDatastoreResponse &response) const
+    {
+        CLogMessage(this).info(u"Merged %1 incremental %2: %3 updated, %4 added, %5 removed | '%6'")
+                << size << entity << updated << added << removed << response.toQString();
+    }
+
+    std::function<void(int)> CDatabaseReader::parsingProgress(CEntityFlags::Entity entity, const QUrl &url)
+    {
+        return [ = ](int number)
+        {
+            if (!this->doWorkCheck()) { return; }
+            emit this->dataRead(entity, CEntityFlags::ReadParsing, number, url);
+        };
+    }
+
     void CDatabaseReader::networkReplyProgress(int logId, qint64 current, qint64 max, const QUrl &url)
     {
         CThreadedReader::networkReplyProgress(logId, current, max, url);
@@ -753,6 +769,11 @@ namespace BlackCore::Db
     }
 
     void CDatabaseReader::stringToDatastoreResponse(const QString &jsonContent, JsonDatastoreResponse &datastoreResponse)
+    {
+        CDatabaseReader::stringToDatastoreResponse(jsonContent.toUtf8(), datastoreResponse);
+    }
+
+    void CDatabaseReader::stringToDatastoreResponse(const QByteArray &jsonContent, JsonDatastoreResponse &datastoreResponse)
     {
         const int status = datastoreResponse.getHttpStatusCode();
         if (jsonContent.isEmpty())
@@ -767,10 +788,11 @@ namespace BlackCore::Db
         const QJsonDocument jsonResponse = CDatabaseUtils::databaseJsonToQJsonDocument(jsonContent);
         if (jsonResponse.isEmpty())
         {
-            if (CNetworkUtils::looksLikePhpErrorMessage(jsonContent))
+            const QString content = QString::fromUtf8(jsonContent);
+            if (CNetworkUtils::looksLikePhpErrorMessage(content))
             {
                 static const QString errorMsg = "Looks like PHP errror, status %1, URL: '%2', msg: %3";
-                const QString phpErrorMessage = CNetworkUtils::removeHtmlPartsFromPhpErrorMessage(jsonContent);
+                const QString phpErrorMessage = CNetworkUtils::removeHtmlPartsFromPhpErrorMessage(content);
                 datastoreResponse.setMessage(CStatusMessage(static_cast<CDatabaseReader *>(nullptr),
                                                 CStatusMessage::SeverityError,
                                                 errorMsg.arg(status).arg(datastoreResponse.getUrlString(), phpErrorMessage)));
@@ -22,6 +22,7 @@
 #include "blackmisc/valueobject.h"
 
 #include <QDateTime>
+#include <QByteArray>
 #include <QJsonArray>
 #include <QMap>
 #include <QObject>
@@ -29,6 +30,7 @@
 #include <QString>
 #include <QtGlobal>
 #include <QNetworkReply>
+#include <functional>
 
 class QNetworkReply;
 class QFileInfo;
@@ -287,6 +289,10 @@ namespace BlackCore::Db
         //! \private used also for samples, that`s why it is declared public
         static void stringToDatastoreResponse(const QString &jsonContent, CDatabaseReader::JsonDatastoreResponse &datastoreResponse);
 
+        //! Transform UTF-8 JSON data to response struct data
+        //! \private used also for samples, that`s why it is declared public
+        static void stringToDatastoreResponse(const QByteArray &jsonContent, CDatabaseReader::JsonDatastoreResponse &datastoreResponse);
+
     signals:
         //! DB have been read
         void swiftDbDataRead(bool success);
@@ -426,6 +432,13 @@ namespace BlackCore::Db
         //! Parsing info message
         void logParseMessage(const QString &entity, int size, int msElapsed, const JsonDatastoreResponse &response) const;
 
+        //! Info message about merging an incremental read into the existing objects
+        void logMergeMessage(const QString &entity, int size, int updated, int added, int removed, const JsonDatastoreResponse &response) const;
+
+        //! Parsing progress, emits dataRead with state ReadParsing and the number of objects parsed so far
+        //! \remark to be called in the reader's thread, as the list conversions call their progress functions
+        std::function<void(int)> parsingProgress(BlackMisc::Network::CEntityFlags::Entity entity, const QUrl &url);
+
         //! Network request progress
         virtual void networkReplyProgress(int logId, qint64 current, qint64 max, const QUrl &url) override;
 
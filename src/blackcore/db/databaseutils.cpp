@@ -12,15 +12,66 @@
 #include "blackmisc/logmessage.h"
 #include "blackmisc/fileutils.h"
 #include "blackmisc/compressutils.h"
+#include "blackmisc/atomicfile.h"
+#include "blackmisc/jsonexception.h"
+#include "blackmisc/db/dbinfo.h"
+#include "blackmisc/simulation/aircraftmodellistbinary.h"
+#include <QCryptographicHash>
 #include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <cstring>
 
 using namespace BlackMisc;
 using namespace BlackMisc::Json;
 using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Db;
 using namespace BlackMisc::Simulation;
 
 namespace BlackCore::Db
 {
+    namespace
+    {
+        //! \private Models file a binary snapshot was written from, stored in front of the model data
+        //! \remark 32 bytes, so the model data stay aligned
+        struct SnapshotSource
+        {
+            char magic[8];     //!< SnapshotMagic
+            qint64 size;       //!< size of the models file
+            char checksum[16]; //!< MD5 of the models file
+        };
+        static_assert(sizeof(SnapshotSource) == 32, "Aligned model data");
+
+        //! \private Magic of SnapshotSource
+        constexpr char SnapshotMagic[8] = { 'S', 'W', 'D', 'B', 'S', 'N', 'P', '1' };
+
+        //! \private Source of the given models file content
+        SnapshotSource snapshotSource(const QByteArray &modelsFileContent)
+        {
+            SnapshotSource source;
+            std::memcpy(source.magic, SnapshotMagic, sizeof(source.magic));
+            source.size = modelsFileContent.size();
+            const QByteArray md5 = QCryptographicHash::hash(modelsFileContent, QCryptographicHash::Md5);
+            std::memcpy(source.checksum, md5.constData(), sizeof(source.checksum));
+            return source;
+        }
+
+        //! \private Write the snapshot of models read from the models file content
+        CStatusMessage writeSnapshot(const QByteArray &modelsFileContent, const CAircraftModelList &models, const QString &snapshotFile)
+        {
+            const SnapshotSource header = snapshotSource(modelsFileContent);
+            QByteArray data(reinterpret_cast<const char *>(&header), sizeof(header));
+            data.append(CAircraftModelListBinary::toBinary(models));
+
+            CAtomicFile file(snapshotFile);
+            if (!(file.open(QFile::WriteOnly) && file.write(data) == data.size() && file.checkedClose()))
+            {
+                return CStatusMessage(static_cast<CDatabaseUtils *>(nullptr)).error(u"Failed to write to '%1': %2") << file.fileName() << file.errorString();
+            }
+            return CStatusMessage(static_cast<CDatabaseUtils *>(nullptr)).info(u"Written %1 models to '%2'") << models.size() << snapshotFile;
+        }
+    }
+
     const QStringList &CDatabaseUtils::getLogCategories()
     {
         static const QStringList cats { CLogCategories::modelCache(), CLogCategories::modelSetCache() };
@@ -435,6 +486,17 @@ namespace BlackCore::Db
         return QJsonDocument::fromJson(byteData);
     }
 
+    QJsonDocument CDatabaseUtils::databaseJsonToQJsonDocument(const QByteArray &content)
+    {
+        const QByteArray trimmed = content.trimmed();
+        if (trimmed.startsWith('{') && trimmed.endsWith('}'))
+        {
+            // uncompressed, same check as Json::looksLikeJson
+            return QJsonDocument::fromJson(trimmed);
+        }
+        return CDatabaseUtils::databaseJsonToQJsonDocument(QString::fromUtf8(content));
+    }
+
     QJsonDocument CDatabaseUtils::readQJsonDocumentFromDatabaseFile(const QString &filename)
     {
         const QString raw = CFileUtils::readFileToString(filename);
@@ -457,6 +519,93 @@ namespace BlackCore::Db
         return CDatabaseUtils::readQJsonObjectFromDatabaseFile(CFileUtils::appendFilePaths(directory, filename));
     }
 
+    QString CDatabaseUtils::binaryModelSnapshotFileName(const QString &modelsFile)
+    {
+        const QFileInfo fi(modelsFile);
+        return CFileUtils::appendFilePaths(fi.path(), fi.completeBaseName() + QStringLiteral(".bin"));
+    }
+
+    CStatusMessage CDatabaseUtils::writeBinaryModelSnapshot(const QString &modelsFile, const QString &snapshotFile)
+    {
+        QFile source(modelsFile);
+        const QByteArray content = source.open(QIODevice::ReadOnly) ? source.readAll() : QByteArray();
+        const QJsonObject modelsJson = content.isEmpty() ? QJsonObject() : CDatabaseUtils::databaseJsonToQJsonDocument(content).object();
+        if (modelsJson.isEmpty())
+        {
+            return CStatusMessage(static_cast<CDatabaseUtils *>(nullptr)).error(u"Failed to read from file/empty file '%1'") << modelsFile;
+        }
+
+        CAircraftModelList models;
+        try
+        {
+            models = CAircraftModelList::fromMultipleJsonFormats(modelsJson);
+        }
+        catch (const CJsonException &ex)
+        {
+            return CStatusMessage::fromJsonException(ex, static_cast<CDatabaseUtils *>(nullptr), QStringLiteral("Reading models from '%1'").arg(modelsFile));
+        }
+        return writeSnapshot(content, models, snapshotFile);
+    }
+
+    CStatusMessage CDatabaseUtils::writeBinaryModelSnapshot(const QString &modelsFile, const CAircraftModelList &models, const QString &snapshotFile)
+    {
+        QFile source(modelsFile);
+        const QByteArray content = source.open(QIODevice::ReadOnly) ? source.readAll() : QByteArray();
+        if (content.isEmpty())
+        {
+            return CStatusMessage(static_cast<CDatabaseUtils *>(nullptr)).error(u"Failed to read from file/empty file '%1'") << modelsFile;
+        }
+        return writeSnapshot(content, models, snapshotFile);
+    }
+
+    CStatusMessageList CDatabaseUtils::writeBinaryDbSnapshots(const QString &directory)
+    {
+        // the other DB files are small, models are the expensive ones
+        const QString modelsFile = CFileUtils::appendFilePaths(directory, CDbInfo::entityToSharedName(BlackMisc::Network::CEntityFlags::ModelEntity));
+        return CDatabaseUtils::writeBinaryModelSnapshot(modelsFile, CDatabaseUtils::binaryModelSnapshotFileName(modelsFile));
+    }
+
+    CAircraftModelList CDatabaseUtils::readBinaryModelSnapshot(const QString &modelsFile, CStatusMessage &o_status)
+    {
+        QFile snapshot(CDatabaseUtils::binaryModelSnapshotFileName(modelsFile));
+        if (!snapshot.exists())
+        {
+            o_status = CStatusMessage(static_cast<CDatabaseUtils *>(nullptr)).info(u"No snapshot '%1'") << snapshot.fileName();
+            return {};
+        }
+        if (!snapshot.open(QIODevice::ReadOnly))
+        {
+            o_status = CStatusMessage(static_cast<CDatabaseUtils *>(nullptr)).error(u"Failed to open '%1': %2") << snapshot.fileName() << snapshot.errorString();
+            return {};
+        }
+
+        // the models are converted in full, so the snapshot is read instead of memory mapped
+        const QByteArray data = snapshot.readAll();
+        snapshot.close();
+        SnapshotSource stored;
+        if (data.size() < static_cast<int>(sizeof(stored)) || std::memcmp(data.constData(), SnapshotMagic, sizeof(SnapshotMagic)) != 0)
+        {
+            o_status = CStatusMessage(static_cast<CDatabaseUtils *>(nullptr)).warning(u"Snapshot '%1' has no models file information") << snapshot.fileName();
+            return {};
+        }
+        std::memcpy(&stored, data.constData(), sizeof(stored));
+
+        // the timestamps of installed files are not reliable, compare the content
+        QFile models(modelsFile);
+        const bool sameSize = models.open(QIODevice::ReadOnly) && models.size() == stored.size;
+        const SnapshotSource current = sameSize ? snapshotSource(models.readAll()) : SnapshotSource();
+        if (!sameSize || std::memcmp(current.checksum, stored.checksum, sizeof(stored.checksum)) != 0)
+        {
+            o_status = CStatusMessage(static_cast<CDatabaseUtils *>(nullptr)).warning(u"Snapshot '%1' was not written from '%2'") << snapshot.fileName() << modelsFile;
+            return {};
+        }
+
+        CAircraftModelListBinary binary(QByteArray::fromRawData(data.constData() + sizeof(stored), data.size() - static_cast<int>(sizeof(stored))));
+        o_status = binary.validate();
+        if (!binary.isValid()) { return {}; }
+        return binary.toAircraftModelList();
+    }
+
     bool CDatabaseUtils::hasDbAircraftData()
     {
         return sApp && sApp->hasWebDataServices() && sApp->getWebDataServices()->hasDbAircraftData();
@@ -79,6 +79,10 @@ namespace BlackCore::Db
         //! Database JSON from content string, which can be compressed
         static QJsonDocument databaseJsonToQJsonDocument(const QString &content);
 
+        //! Database JSON from UTF-8 content, which can be compressed
+        //! \remark uncompressed JSON is parsed directly, without a UTF-16 copy of the content
+        static QJsonDocument databaseJsonToQJsonDocument(const QByteArray &content);
+
         //! QJsonDocument from database JSON file (normally shared file)
         static QJsonDocument readQJsonDocumentFromDatabaseFile(const QString &filename);
 
@@ -88,6 +92,25 @@ namespace BlackCore::Db
         //! QJsonObject from database JSON file (normally shared file)
         static QJsonObject readQJsonObjectFromDatabaseFile(const QString &directory, const QString &filename);
 
+        //! File name of the binary snapshot of a DB models file, "models.json" -> "models.bin"
+        static QString binaryModelSnapshotFileName(const QString &modelsFile);
+
+        //! Write the binary snapshot of a DB models file (JSON, can be compressed)
+        //! \remark reading the snapshot is much faster than parsing the JSON file, though the models are still converted in full
+        //! \remark size and MD5 of the models file are stored in the snapshot
+        static BlackMisc::CStatusMessage writeBinaryModelSnapshot(const QString &modelsFile, const QString &snapshotFile);
+
+        //! Write the binary snapshot of a DB models file from the models already read from it
+        static BlackMisc::CStatusMessage writeBinaryModelSnapshot(const QString &modelsFile, const BlackMisc::Simulation::CAircraftModelList &models, const QString &snapshotFile);
+
+        //! Write the binary snapshots of the DB files in directory
+        static BlackMisc::CStatusMessageList writeBinaryDbSnapshots(const QString &directory);
+
+        //! Models from the binary snapshot of a DB models file
+        //! \remark empty if there is no snapshot, or if it was not written from the current models file (size and MD5),
+        //!         also if the models file can not be read
+        static BlackMisc::Simulation::CAircraftModelList readBinaryModelSnapshot(const QString &modelsFile, BlackMisc::CStatusMessage &o_status);
+
         //! Convenience function
         static bool hasDbAircraftData();
 
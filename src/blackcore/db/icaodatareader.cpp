@@ -314,14 +314,18 @@ namespace BlackCore::Db
             const CAircraftIcaoCodeList incrementalCodes(CAircraftIcaoCodeList::fromDatabaseJson(res, categories, true, &inconsistent));
             if (incrementalCodes.isEmpty()) { return; } // currently ignored
             codes = this->getAircraftIcaoCodes();
-            codes.replaceOrAddObjectsByKey(incrementalCodes);
+            int updated = 0;
+            int added = 0;
+            int removed = 0;
+            codes.replaceOrAddObjectsByKey(incrementalCodes, &updated, &added, &removed);
+            this->logMergeMessage("aircraft ICAO", incrementalCodes.size(), updated, added, removed, res);
         }
         else
         {
             // normally read from special DB view which already filters incomplete
             QElapsedTimer time;
             time.start();
-            codes  = CAircraftIcaoCodeList::fromDatabaseJson(res, categories, true, &inconsistent);
+            codes  = CAircraftIcaoCodeList::fromDatabaseJson(res, categories, true, &inconsistent, this->parsingProgress(CEntityFlags::AircraftIcaoEntity, url));
             this->logParseMessage("aircraft ICAO", codes.size(), static_cast<int>(time.elapsed()), res);
         }
 
@@ -370,14 +374,18 @@ namespace BlackCore::Db
             const CAirlineIcaoCodeList incrementalCodes(CAirlineIcaoCodeList::fromDatabaseJson(res, true, &inconsistent));
             if (incrementalCodes.isEmpty()) { return; } // currently ignored
             codes = this->getAirlineIcaoCodes();
-            codes.replaceOrAddObjectsByKey(incrementalCodes);
+            int updated = 0;
+            int added = 0;
+            int removed = 0;
+            codes.replaceOrAddObjectsByKey(incrementalCodes, &updated, &added, &removed);
+            this->logMergeMessage("airline ICAO", incrementalCodes.size(), updated, added, removed, res);
         }
         else
         {
             // normally read from special DB view which already filters incomplete
             QElapsedTimer time;
             time.start();
-            codes = CAirlineIcaoCodeList::fromDatabaseJson(res, true, &inconsistent);
+            codes = CAirlineIcaoCodeList::fromDatabaseJson(res, true, &inconsistent, this->parsingProgress(CEntityFlags::AirlineIcaoEntity, url));
             this->logParseMessage("airline ICAO", codes.size(), static_cast<int>(time.elapsed()), res);
         }
 
@@ -424,7 +432,11 @@ namespace BlackCore::Db
             const CCountryList incrementalCountries(CCountryList::fromDatabaseJson(res));
             if (incrementalCountries.isEmpty()) { return; } // currently ignored
             countries = this->getCountries();
-            countries.replaceOrAddObjectsByKey(incrementalCountries);
+            int updated = 0;
+            int added = 0;
+            int removed = 0;
+            countries.replaceOrAddObjectsByKey(incrementalCountries, &updated, &added, &removed);
+            this->logMergeMessage("countries", incrementalCountries.size(), updated, added, removed, res);
         }
         else
         {
@@ -471,7 +483,11 @@ namespace BlackCore::Db
             const CAircraftCategoryList incrementalCategories(CAircraftCategoryList::fromDatabaseJson(res));
             if (incrementalCategories.isEmpty()) { return; } // currently ignored
             categories = this->getAircraftCategories();
-            categories.replaceOrAddObjectsByKey(incrementalCategories);
+            int updated = 0;
+            int added = 0;
+            int removed = 0;
+            categories.replaceOrAddObjectsByKey(incrementalCategories, &updated, &added, &removed);
+            this->logMergeMessage("aircraft categories", incrementalCategories.size(), updated, added, removed, res);
         }
         else
         {
@@ -15,6 +15,7 @@
 #include "blackmisc/json.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/statusmessage.h"
+#include "blackmisc/swiftdirectories.h"
 
 #include <QDir>
 #include <QFlags>
@@ -315,13 +316,17 @@ namespace BlackCore::Db
             const CLiveryList incrementalLiveries(CLiveryList::fromDatabaseJson(res));
             if (incrementalLiveries.isEmpty()) { return; } // currenty ignored
             liveries = this->getLiveries();
-            liveries.replaceOrAddObjectsByKey(incrementalLiveries);
+            int updated = 0;
+            int added = 0;
+            int removed = 0;
+            liveries.replaceOrAddObjectsByKey(incrementalLiveries, &updated, &added, &removed);
+            this->logMergeMessage("liveries", incrementalLiveries.size(), updated, added, removed, res);
         }
         else
         {
             QElapsedTimer time;
             time.start();
-            liveries  = CLiveryList::fromDatabaseJson(res);
+            liveries  = CLiveryList::fromDatabaseJson(res, this->parsingProgress(CEntityFlags::LiveryEntity, res.getUrl()));
             this->logParseMessage("liveries", liveries.size(), static_cast<int>(time.elapsed()), res);
         }
 
@@ -363,7 +368,11 @@ namespace BlackCore::Db
             const CDistributorList incrementalDistributors(CDistributorList::fromDatabaseJson(res));
             if (incrementalDistributors.isEmpty()) { return; } // currently ignored
             distributors = this->getDistributors();
-            distributors.replaceOrAddObjectsByKey(incrementalDistributors);
+            int updated = 0;
+            int added = 0;
+            int removed = 0;
+            distributors.replaceOrAddObjectsByKey(incrementalDistributors, &updated, &added, &removed);
+            this->logMergeMessage("distributors", incrementalDistributors.size(), updated, added, removed, res);
         }
         else
         {
@@ -421,13 +430,17 @@ namespace BlackCore::Db
             const CAircraftModelList incrementalModels(CAircraftModelList::fromDatabaseJsonCaching(res, icaos, categories, liveries, distributors));
             if (incrementalModels.isEmpty()) { return; } // currently ignored
             models = this->getModels();
-            models.replaceOrAddObjectsByKey(incrementalModels);
+            int updated = 0;
+            int added = 0;
+            int removed = 0;
+            models.replaceOrAddObjectsByKey(incrementalModels, &updated, &added, &removed);
+            this->logMergeMessage("models", incrementalModels.size(), updated, added, removed, res);
         }
         else
         {
             QElapsedTimer time;
             time.start();
-            models = CAircraftModelList::fromDatabaseJsonCaching(res, icaos, categories, liveries, distributors);
+            models = CAircraftModelList::fromDatabaseJsonCaching(res, icaos, categories, liveries, distributors, this->parsingProgress(CEntityFlags::ModelEntity, res.getUrl()));
             this->logParseMessage("models", models.size(), static_cast<int>(time.elapsed()), res);
         }
 
@@ -447,6 +460,37 @@ namespace BlackCore::Db
         this->emitAndLogDataRead(CEntityFlags::ModelEntity, n, res);
     }
 
+    bool CModelDataReader::readModelsFromBinarySnapshot(const QFileInfo &modelsFile, CStatusMessageList &msgs)
+    {
+        CStatusMessage status;
+        const CAircraftModelList models = CDatabaseUtils::readBinaryModelSnapshot(modelsFile.absoluteFilePath(), status);
+        if (status.isFailure() || models.isEmpty())
+        {
+            if (status.isWarningOrAbove()) { msgs.push_back(status); }
+            return false;
+        }
+
+        // same timestamp as if read from the JSON file
+        const int c = models.size();
+        msgs.push_back(m_modelCache.set(models, modelsFile.birthTime().toUTC().toMSecsSinceEpoch()));
+        emit this->dataRead(CEntityFlags::ModelEntity, CEntityFlags::ReadFinished, c, QUrl::fromLocalFile(CDatabaseUtils::binaryModelSnapshotFileName(modelsFile.absoluteFilePath())));
+        return true;
+    }
+
+    void CModelDataReader::writeBundledModelsSnapshot(const QFileInfo &modelsFile, const CAircraftModelList &models)
+    {
+        // the snapshot is written when installing, but the install step can fail or be skipped
+        if (modelsFile.absolutePath() != QDir(CSwiftDirectories::staticDbFilesDirectory()).absolutePath()) { return; }
+        const CStatusMessage msg = CDatabaseUtils::writeBinaryModelSnapshot(modelsFile.absoluteFilePath(), models, CDatabaseUtils::binaryModelSnapshotFileName(modelsFile.absoluteFilePath()));
+        if (msg.isFailure())
+        {
+            // e.g. installed read only, the models are read from the JSON file again
+            CLogMessage(this).info(u"No binary snapshot of the bundled models: %1") << msg.getMessage();
+            return;
+        }
+        CLogMessage::preformatted(msg);
+    }
+
     CStatusMessageList CModelDataReader::readFromJsonFiles(const QString &dir, CEntityFlags::Entity whatToRead, bool overrideNewerOnly)
     {
         const QDir directory(dir);
@@ -510,6 +554,10 @@ namespace BlackCore::Db
             {
                 // void
             }
+            else if (this->readModelsFromBinarySnapshot(fi, msgs))
+            {
+                reallyRead |= CEntityFlags::ModelEntity;
+            }
             else
             {
                 const QJsonObject modelsJson(CDatabaseUtils::readQJsonObjectFromDatabaseFile(fileName));
@@ -528,6 +576,7 @@ namespace BlackCore::Db
                         msgs.push_back(m_modelCache.set(models, fi.birthTime().toUTC().toMSecsSinceEpoch()));
                         emit this->dataRead(CEntityFlags::ModelEntity, CEntityFlags::ReadFinished, c, url);
                         reallyRead |= CEntityFlags::ModelEntity;
+                        this->writeBundledModelsSnapshot(fi, models);
                     }
                     catch (const CJsonException &ex)
                     {
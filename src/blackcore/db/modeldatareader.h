@@ -30,6 +30,7 @@
 #include <QStringList>
 #include <QSet>
 
+class QFileInfo;
 class QNetworkReply;
 
 namespace BlackCore::Db
@@ -177,6 +178,14 @@ namespace BlackCore::Db
         //! Models have been read
         void parseModelData(QNetworkReply *nwReply);
 
+        //! Set the model cache from the prebuilt binary snapshot of the models file
+        //! \remark false if there is no up to date snapshot, then the JSON file has to be read
+        bool readModelsFromBinarySnapshot(const QFileInfo &modelsFile, BlackMisc::CStatusMessageList &msgs);
+
+        //! Write the binary snapshot of the bundled models file if it was read from JSON
+        //! \remark fallback if the snapshot was not written when installing
+        void writeBundledModelsSnapshot(const QFileInfo &modelsFile, const BlackMisc::Simulation::CAircraftModelList &models);
+
         //! Livery cache changed elsewhere
         void liveryCacheChanged();
 
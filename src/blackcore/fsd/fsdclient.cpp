@@ -52,10 +52,13 @@
 #include "blackconfig/buildconfig.h"
 
 #include <QHostAddress>
+#include <QElapsedTimer>
 #include <QStringBuilder>
 #include <QStringView>
 #include <QNetworkReply>
 
+#include <algorithm>
+
 using namespace BlackConfig;
 using namespace BlackCore::Vatsim;
 using namespace BlackMisc;
@@ -831,33 +834,50 @@ namespace BlackCore::Fsd
         emitRawFsdMessage(message.trimmed(), true);
     }
 
+    void CFSDClient::enqueueMessageString(const QString &message, const QString &coalescingKey)
+    {
+        if (message.isEmpty()) { return; }
+        if (!coalescingKey.isEmpty())
+        {
+            // replace the outdated message in place, the newer one is sent without further delay
+            for (QueuedFsdMessage &queued : m_queuedFsdMessages)
+            {
+                if (queued.coalescingKey != coalescingKey) { continue; }
+                queued.message = message;
+                increaseStatisticsValue(QStringLiteral("coalescedFsdMessages"));
+                return;
+            }
+        }
+        m_queuedFsdMessages.enqueue({ message, coalescingKey });
+    }
+
     void CFSDClient::sendQueuedMessage()
     {
         if (m_queuedFsdMessages.isEmpty()) { return; }
         const int s = m_queuedFsdMessages.size();
-        this->sendMessageString(m_queuedFsdMessages.dequeue());
-
-        // send up to 6 at once
-        if (s > 5)  { this->sendMessageString(m_queuedFsdMessages.dequeue()); }
-        if (s > 10) { this->sendMessageString(m_queuedFsdMessages.dequeue()); }
-        if (s > 20) { this->sendMessageString(m_queuedFsdMessages.dequeue()); }
-        if (s > 30) { this->sendMessageString(m_queuedFsdMessages.dequeue()); }
 
         // overload
         // no idea, if we ever get here
-        if (s > 50)
+        if (s > c_sendFsdMsgMaxPerWrite)
         {
-            const StatusSeverity severity = s > 75 ? SeverityWarning : SeverityInfo;
+            const StatusSeverity severity = s > 2 * c_sendFsdMsgMaxPerWrite ? SeverityWarning : SeverityInfo;
             CLogMessage(this).log(severity, u"Too many queued messages (%1), bulk send!") << s;
-            int sendNo = 10;
-            if (s > 75)  { sendNo = 20; }
-            if (s > 100) { sendNo = 30; }
+        }
 
-            for (int i = 0; i < sendNo; i++)
-            {
-                this->sendMessageString(m_queuedFsdMessages.dequeue());
-            }
+        // all messages of this tick are written at once
+        const bool raw = m_unitTestMode || m_rawFsdMessagesEnabled;
+        const int sendNo = qMin(s, c_sendFsdMsgMaxPerWrite);
+        if (m_sendBuffer.capacity() < 4096) { m_sendBuffer.reserve(4096); } // reserved capacity is kept by resize(0)
+        m_sendBuffer.resize(0);
+        for (int i = 0; i < sendNo; i++)
+        {
+            const QueuedFsdMessage queued = m_queuedFsdMessages.dequeue();
+            m_sendBuffer += m_fsdTextCodec->fromUnicode(queued.message);
+            if (raw) { emitRawFsdMessage(queued.message.trimmed(), true); }
         }
+
+        if (m_printToConsole) { qDebug() << "FSD Sent=>" << m_sendBuffer; }
+        if (!m_unitTestMode)  { m_socket->write(m_sendBuffer); }
     }
 
     void CFSDClient::sendFsdMessage(const QString &message)
@@ -1233,7 +1253,16 @@ namespace BlackCore::Fsd
 
     void CFSDClient::handlePilotDataUpdate(const QStringList &tokens)
     {
-        const PilotDataUpdate dataUpdate = PilotDataUpdate::fromTokens(tokens);
+        this->handlePilotDataUpdate(PilotDataUpdate::fromTokens(tokens));
+    }
+
+    void CFSDClient::handlePilotDataUpdate(const FsdLine &tokens)
+    {
+        this->handlePilotDataUpdate(PilotDataUpdate::fromTokens(tokens));
+    }
+
+    void CFSDClient::handlePilotDataUpdate(const PilotDataUpdate &dataUpdate)
+    {
         const CCallsign callsign(dataUpdate.sender(), CCallsign::Aircraft);
 
         CAircraftSituation situation(
@@ -1308,6 +1337,21 @@ namespace BlackCore::Fsd
             case MessageType::VisualPilotDataStopped:   dataUpdate = VisualPilotDataStopped::fromTokens(tokens).toUpdate();     break;
             default: qFatal("Precondition violated");   break;
         }
+        this->handleVisualPilotDataUpdate(dataUpdate);
+    }
+
+    void CFSDClient::handleVisualPilotDataUpdate(const FsdLine &tokens, MessageType messageType)
+    {
+        switch (messageType)
+        {
+            case MessageType::VisualPilotDataUpdate:    this->handleVisualPilotDataUpdate(VisualPilotDataUpdate::fromTokens(tokens));                break;
+            case MessageType::VisualPilotDataPeriodic:  this->handleVisualPilotDataUpdate(VisualPilotDataPeriodic::fromTokens(tokens).toUpdate());   break;
+            default: this->handleVisualPilotDataUpdate(tokens.toTokens(), messageType); break; // rare, use the classic path
+        }
+    }
+
+    void CFSDClient::handleVisualPilotDataUpdate(const VisualPilotDataUpdate &dataUpdate)
+    {
         const CCallsign callsign(dataUpdate.sender(), CCallsign::Aircraft);
 
         CAircraftSituation situation(
@@ -1662,6 +1706,7 @@ namespace BlackCore::Fsd
         {
             readDataFromSocket();
             CLogMessage(this).debug(u"Successfully switched server");
+            discardIncompleteReceivedLine(); // a partial line from the old server would corrupt the first new line
             QObject::disconnect(newSocket);
             m_socket.reset(newSocket);
             m_rehosting = false;
@@ -1887,20 +1932,22 @@ namespace BlackCore::Fsd
         Q_ASSERT_X(!callsign.isEmpty(), Q_FUNC_INFO, "Need callsign");
 
         if (markerTs < 0) { markerTs = QDateTime::currentMSecsSinceEpoch(); }
-        if (!m_lastPositionUpdate.contains(callsign))
+        const CCallsignId id(callsign);
+        const auto lastUpdate = m_lastPositionUpdate.find(id);
+        if (lastUpdate == m_lastPositionUpdate.end())
         {
-            m_lastPositionUpdate.insert(callsign, markerTs);
+            m_lastPositionUpdate.insert(id, markerTs);
             return CFsdSetup::c_positionTimeOffsetMsec;
         }
-        const qint64 oldTs = m_lastPositionUpdate.value(callsign);
-        m_lastPositionUpdate[callsign] = markerTs;
+        const qint64 oldTs = *lastUpdate;
+        *lastUpdate = markerTs;
 
         // Ref T297, dynamic offsets
         const qint64 diff = qAbs(markerTs - oldTs);
-        this->insertLatestOffsetTime(callsign, diff);
+        this->insertLatestOffsetTime(id, diff);
 
         int count = 0;
-        const qint64 avgTimeMs = this->averageOffsetTimeMs(callsign, count, 3); // latest average
+        const qint64 avgTimeMs = this->averageOffsetTimeMs(id, count, 3); // latest average
         qint64 targetOffsetTime = CFsdSetup::c_positionTimeOffsetMsec;
 
         if (avgTimeMs < CFsdSetup::c_minimumPositionTimeOffsetMsec && count >= 3)
@@ -1908,7 +1955,7 @@ namespace BlackCore::Fsd
             targetOffsetTime = CFsdSetup::c_minimumPositionTimeOffsetMsec;
         }
 
-        const qint64 previousInterpolatedOffsetTime = m_interpolatedOffsetTime.value(callsign, 0);
+        const qint64 previousInterpolatedOffsetTime = m_interpolatedOffsetTime.value(id, 0);
         qint64 offsetDiff = 0;
         if (targetOffsetTime < previousInterpolatedOffsetTime)
         {
@@ -1919,7 +1966,7 @@ namespace BlackCore::Fsd
             offsetDiff = std::min(targetOffsetTime - previousInterpolatedOffsetTime, diff / c_offsetTimeInterpolationInverseRate);
         }
         qint64 offsetTime = previousInterpolatedOffsetTime + offsetDiff;
-        m_interpolatedOffsetTime.insert(callsign, offsetTime);
+        m_interpolatedOffsetTime.insert(id, offsetTime);
         return m_additionalOffsetTime + offsetTime;
     }
 
@@ -1927,8 +1974,9 @@ namespace BlackCore::Fsd
     {
         Q_ASSERT_X(!callsign.isEmpty(), Q_FUNC_INFO, "Need callsign");
 
-        if (!m_lastOffsetTimes.contains(callsign) || m_lastOffsetTimes[callsign].isEmpty()) { return CFsdSetup::c_positionTimeOffsetMsec; }
-        return m_lastOffsetTimes[callsign].front();
+        const auto offsets = m_lastOffsetTimes.constFind(CCallsignId(callsign));
+        if (offsets == m_lastOffsetTimes.constEnd() || offsets->isEmpty()) { return CFsdSetup::c_positionTimeOffsetMsec; }
+        return offsets->front();
     }
 
     void CFSDClient::clearState()
@@ -1943,6 +1991,7 @@ namespace BlackCore::Fsd
         m_lastOffsetTimes.clear();
         m_atcStations.clear();
         m_queuedFsdMessages.clear();
+        this->clearReceiveBuffer();
         m_sentAircraftConfig = CAircraftParts::null();
         m_loginSince = -1;
     }
@@ -1951,21 +2000,22 @@ namespace BlackCore::Fsd
     {
         if (callsign.isEmpty()) { return; }
         m_pendingAtisQueries.remove(callsign);
-        m_lastPositionUpdate.remove(callsign);
+        const CCallsignId id(callsign);
+        m_lastPositionUpdate.remove(id);
         m_interimPositionReceivers.remove(callsign);
-        m_lastOffsetTimes.remove(callsign);
+        m_lastOffsetTimes.remove(id);
     }
 
-    void CFSDClient::insertLatestOffsetTime(const CCallsign &callsign, qint64 offsetMs)
+    void CFSDClient::insertLatestOffsetTime(CCallsignId id, qint64 offsetMs)
     {
-        QList<qint64> &offsets = m_lastOffsetTimes[callsign];
+        QList<qint64> &offsets = m_lastOffsetTimes[id];
         offsets.push_front(offsetMs);
         if (offsets.size() > MaxOffseTimes) { offsets.removeLast(); }
     }
 
-    qint64 CFSDClient::averageOffsetTimeMs(const CCallsign &callsign, int &count, int maxLastValues) const
+    qint64 CFSDClient::averageOffsetTimeMs(CCallsignId id, int &count, int maxLastValues) const
     {
-        const QList<qint64> &offsets = m_lastOffsetTimes[callsign];
+        const QList<qint64> offsets = m_lastOffsetTimes.value(id);
         if (offsets.size() < 1) { return -1; }
         qint64 sum = 0;
         count = 0;
@@ -1978,10 +2028,10 @@ namespace BlackCore::Fsd
         return qRound(static_cast<double>(sum) / count);
     }
 
-    qint64 CFSDClient::averageOffsetTimeMs(const CCallsign &callsign, int maxLastValues) const
+    qint64 CFSDClient::averageOffsetTimeMs(CCallsignId id, int maxLastValues) const
     {
         int count = 0;
-        return this->averageOffsetTimeMs(callsign, maxLastValues, count);
+        return this->averageOffsetTimeMs(id, maxLastValues, count);
     }
 
     bool CFSDClient::isInterimPositionSendingEnabledForServer() const
@@ -2114,6 +2164,10 @@ namespace BlackCore::Fsd
         QWriteLocker l(&m_lockStatistics);
         m_callStatistics.clear();
         m_callByTime.clear();
+        m_readMaxBacklogBytes = 0;
+        m_readDeferredDrains  = 0;
+        m_readLastLatencyMs   = 0;
+        m_readMaxLatencyMs    = 0;
     }
 
     QString CFSDClient::getNetworkStatisticsAsText(bool reset, const QString &separator)
@@ -2152,6 +2206,11 @@ namespace BlackCore::Fsd
                 pair.second % u": " % QString::number(pair.first);
         }
 
+        stats += separator %
+                    u"Read backlog: " % QString::number(m_readBacklogBytes.load()) % u" bytes, " % QString::number(m_readBacklogLines.load()) % u" lines (max " %
+                    QString::number(m_readMaxBacklogBytes.load()) % u" bytes), deferred drains: " % QString::number(m_readDeferredDrains.load()) %
+                    u", latency: " % QString::number(m_readLastLatencyMs.load()) % u"ms (max " % QString::number(m_readMaxLatencyMs.load()) % u"ms)";
+
         if (!callByTime.isEmpty())
         {
             const qint64 lastTs = callByTime.front().first;
@@ -2172,40 +2231,121 @@ namespace BlackCore::Fsd
         quitAndWait();
     }
 
-    void CFSDClient::readDataFromSocketMaxLines(int maxLines)
+    void CFSDClient::readDataFromSocket()
+    {
+        // read in large chunks, lines are split in place by drainReceiveBuffer
+        qint64 available = m_socket->bytesAvailable();
+        if (available > 0)
+        {
+            // reuse the already parsed front part
+            if (m_receiveBufferOffset > 0 && m_receiveBufferOffset >= m_receiveBuffer.size() / 2)
+            {
+                m_receiveBuffer.remove(0, m_receiveBufferOffset);
+                m_receiveBufferOffset = 0;
+            }
+
+            while (available > 0)
+            {
+                const int chunk = static_cast<int>(qMin<qint64>(available, c_readChunkBytes));
+                const int oldSize = m_receiveBuffer.size();
+                m_receiveBuffer.resize(oldSize + chunk);
+                const qint64 read = m_socket->read(m_receiveBuffer.data() + oldSize, chunk);
+                m_receiveBuffer.resize(oldSize + static_cast<int>(qMax<qint64>(0, read)));
+                if (read < chunk) { break; }
+                available = m_socket->bytesAvailable();
+            }
+
+            if (m_receiveBacklogSinceMs < 0) { m_receiveBacklogSinceMs = QDateTime::currentMSecsSinceEpoch(); }
+            const int backlog = m_receiveBuffer.size() - m_receiveBufferOffset;
+            if (backlog > m_readMaxBacklogBytes) { m_readMaxBacklogBytes = backlog; }
+        }
+
+        if (!m_drainScheduled) { this->drainReceiveBuffer(); }
+    }
+
+    void CFSDClient::drainReceiveBuffer()
     {
-        if (m_socket->bytesAvailable() < 1) { return; }
+        m_drainScheduled = false;
 
-        int lines = 0;
+        QElapsedTimer budget;
+        budget.start();
+        bool exceeded = false;
 
-        // reads at least one line if available
-        while (m_socket->canReadLine())
+        // parses at least one line if available
+        while (m_receiveBufferOffset < m_receiveBuffer.size())
         {
-            const QByteArray dataEncoded = m_socket->readLine();
-            if (dataEncoded.isEmpty()) { continue; }
-            const QString data = m_fsdTextCodec->toUnicode(dataEncoded);
-            this->parseMessage(data);
-            lines++;
+            const int eol = m_receiveBuffer.indexOf('\n', m_receiveBufferOffset);
+            if (eol < 0) { break; } // incomplete line
 
-            static constexpr int MaxLines = 75 - 1;
-            if (maxLines < 0) { maxLines = MaxLines; }
+            const QByteArray dataEncoded = m_receiveBuffer.mid(m_receiveBufferOffset, eol - m_receiveBufferOffset + 1);
+            m_receiveBufferOffset = eol + 1;
+            this->parseMessage(dataEncoded);
 
-            if (lines > maxLines)
+            if (budget.nsecsElapsed() > c_readBudgetUs * 1000LL)
             {
-                static constexpr int DelayMs  = 10;
-                const int newMax = qRound(1.2 * lines); // 20% more
-
-                CLogMessage(this).debug(u"ReadDataFromSocket has too many lines (>%1), will read again in %2ms") << MaxLines << DelayMs;
-                QPointer<CFSDClient> myself(this);
-                QTimer::singleShot(DelayMs, this, [ = ]
-                {
-                    if (!sApp || sApp->isShuttingDown()) { return; }
-                    if (myself) { myself->readDataFromSocketMaxLines(newMax); }
-                });
+                exceeded = true;
                 break;
             }
+        }
+
+        if (m_receiveBufferOffset >= m_receiveBuffer.size())
+        {
+            m_receiveBuffer.clear();
+            m_receiveBufferOffset = 0;
+        }
+
+        const char *pending = m_receiveBuffer.constData() + m_receiveBufferOffset;
+        const int pendingBytes = m_receiveBuffer.size() - m_receiveBufferOffset;
+        const int pendingLines = exceeded ? static_cast<int>(std::count(pending, pending + pendingBytes, '\n')) : 0;
+        m_readBacklogBytes = pendingBytes;
+        m_readBacklogLines = pendingLines;
+
+        if (pendingLines > 0)
+        {
+            m_readDeferredDrains++;
+            this->scheduleDrainReceiveBuffer();
+        }
+        else if (m_receiveBacklogSinceMs >= 0)
+        {
+            const qint64 latencyMs = QDateTime::currentMSecsSinceEpoch() - m_receiveBacklogSinceMs;
+            m_receiveBacklogSinceMs = -1;
+            m_readLastLatencyMs = latencyMs;
+            if (latencyMs > m_readMaxLatencyMs) { m_readMaxLatencyMs = latencyMs; }
+        }
+    }
+
+    void CFSDClient::scheduleDrainReceiveBuffer()
+    {
+        if (m_drainScheduled) { return; }
+        m_drainScheduled = true;
+
+        // next event loop turn, so timers and socket signals are processed in between
+        QPointer<CFSDClient> myself(this);
+        QTimer::singleShot(0, this, [ = ]
+        {
+            if (!sApp || sApp->isShuttingDown()) { return; }
+            if (myself) { myself->drainReceiveBuffer(); }
+        });
+    }
 
+    void CFSDClient::discardIncompleteReceivedLine()
+    {
+        const int lastEol = m_receiveBuffer.lastIndexOf('\n');
+        if (lastEol < m_receiveBufferOffset)
+        {
+            this->clearReceiveBuffer();
+            return;
         }
+        m_receiveBuffer.truncate(lastEol + 1);
+    }
+
+    void CFSDClient::clearReceiveBuffer()
+    {
+        m_receiveBuffer.clear();
+        m_receiveBufferOffset = 0;
+        m_receiveBacklogSinceMs = -1;
+        m_readBacklogBytes = 0;
+        m_readBacklogLines = 0;
     }
 
     QString CFSDClient::socketErrorString(QAbstractSocket::SocketError error) const
@@ -2226,22 +2366,18 @@ namespace BlackCore::Fsd
 
     void CFSDClient::parseMessage(const QString &lineRaw)
     {
-        MessageType messageType = MessageType::Unknown;
-        QString cmd;
-        const QString line = lineRaw.trimmed();
+        // UNIT tests and debugging, encode and use the byte level parser
+        this->parseMessage(m_fsdTextCodec ? m_fsdTextCodec->fromUnicode(lineRaw) : lineRaw.toUtf8());
+    }
 
-        if (m_printToConsole) { qDebug() << "FSD Recv=>" << line; }
-        emitRawFsdMessage(line, false);
+    void CFSDClient::parseMessage(const QByteArray &lineEncoded)
+    {
+        const FsdLine fsdLine(lineEncoded, m_fsdTextCodec);
+        const MessageType messageType = fsdLine.messageType();
 
-        for (const QString &str : makeKeysRange(std::as_const(m_messageTypeMapping)))
-        {
-            if (line.startsWith(str))
-            {
-                cmd = str;
-                messageType = m_messageTypeMapping.value(str, MessageType::Unknown);
-                break;
-            }
-        }
+        // only decode the whole line if really needed
+        if (m_printToConsole) { qDebug() << "FSD Recv=>" << fsdLine.toLineString(); }
+        if (m_unitTestMode || m_rawFsdMessagesEnabled) { emitRawFsdMessage(fsdLine.toLineString(), false); }
 
         // statistics
         if (m_statistics)
@@ -2251,13 +2387,9 @@ namespace BlackCore::Fsd
 
         if (messageType != MessageType::Unknown)
         {
-            // Cutoff the cmd from the beginning
-            const QString payload = line.mid(cmd.size()).trimmed();
-
             // We expected a payload, but there is nothing
-            if (payload.length() == 0) { return; }
+            if (!fsdLine.hasPayload()) { return; }
 
-            const QStringList tokens = payload.split(':');
             switch (messageType)
             {
             // ignored ones
@@ -2271,41 +2403,43 @@ namespace BlackCore::Fsd
 
                 break;
 
-            // handled ones
-            case MessageType::AtcDataUpdate:     handleAtcDataUpdate(tokens);     break;
-            case MessageType::AuthChallenge:     handleAuthChallenge(tokens);     break;
-            case MessageType::AuthResponse:      handleAuthResponse(tokens);      break;
-            case MessageType::ClientQuery:       handleClientQuery(tokens);       break;
-            case MessageType::ClientResponse:    handleClientReponse(tokens);     break;
-            case MessageType::DeleteATC:         handleDeleteATC(tokens);         break;
-            case MessageType::DeletePilot:       handleDeletePilot(tokens);       break;
-            case MessageType::FlightPlan:        handleFlightPlan(tokens);        break;
-            case MessageType::FsdIdentification: handleFsdIdentification(tokens); break;
-            case MessageType::KillRequest:       handleKillRequest(tokens);       break;
-            case MessageType::PilotDataUpdate:   handlePilotDataUpdate(tokens);   break;
-            case MessageType::Ping:              handlePing(tokens);              break;
-            case MessageType::Pong:              handlePong(tokens);              break;
-            case MessageType::ServerError:       handleServerError(tokens);       break;
-            case MessageType::TextMessage:       handleTextMessage(tokens);       break;
-            case MessageType::PilotClientCom:    handleCustomPilotPacket(tokens); break;
-            case MessageType::RevBClientParts:   handleRevBClientPartsPacket(tokens); break;
+            // hot path, tokens are converted on demand
+            case MessageType::PilotDataUpdate:   handlePilotDataUpdate(fsdLine);  break;
             case MessageType::VisualPilotDataUpdate:
             case MessageType::VisualPilotDataPeriodic:
-            case MessageType::VisualPilotDataStopped:  handleVisualPilotDataUpdate(tokens, messageType); break;
-            case MessageType::VisualPilotDataToggle:   handleVisualPilotDataToggle(tokens); break;
-            case MessageType::EuroscopeSimData:  handleEuroscopeSimData(tokens);  break;
-            case MessageType::Rehost:            handleRehost(tokens);            break;
+            case MessageType::VisualPilotDataStopped:  handleVisualPilotDataUpdate(fsdLine, messageType); break;
+
+            // handled ones
+            case MessageType::AtcDataUpdate:     handleAtcDataUpdate(fsdLine.toTokens());     break;
+            case MessageType::AuthChallenge:     handleAuthChallenge(fsdLine.toTokens());     break;
+            case MessageType::AuthResponse:      handleAuthResponse(fsdLine.toTokens());      break;
+            case MessageType::ClientQuery:       handleClientQuery(fsdLine.toTokens());       break;
+            case MessageType::ClientResponse:    handleClientReponse(fsdLine.toTokens());     break;
+            case MessageType::DeleteATC:         handleDeleteATC(fsdLine.toTokens());         break;
+            case MessageType::DeletePilot:       handleDeletePilot(fsdLine.toTokens());       break;
+            case MessageType::FlightPlan:        handleFlightPlan(fsdLine.toTokens());        break;
+            case MessageType::FsdIdentification: handleFsdIdentification(fsdLine.toTokens()); break;
+            case MessageType::KillRequest:       handleKillRequest(fsdLine.toTokens());       break;
+            case MessageType::Ping:              handlePing(fsdLine.toTokens());              break;
+            case MessageType::Pong:              handlePong(fsdLine.toTokens());              break;
+            case MessageType::ServerError:       handleServerError(fsdLine.toTokens());       break;
+            case MessageType::TextMessage:       handleTextMessage(fsdLine.toTokens());       break;
+            case MessageType::PilotClientCom:    handleCustomPilotPacket(fsdLine.toTokens()); break;
+            case MessageType::RevBClientParts:   handleRevBClientPartsPacket(fsdLine.toTokens()); break;
+            case MessageType::VisualPilotDataToggle:   handleVisualPilotDataToggle(fsdLine.toTokens()); break;
+            case MessageType::EuroscopeSimData:  handleEuroscopeSimData(fsdLine.toTokens());  break;
+            case MessageType::Rehost:            handleRehost(fsdLine.toTokens());            break;
 
             // normally we should not get here
             default:
             case MessageType::Unknown:
-                handleUnknownPacket(tokens);
+                handleUnknownPacket(fsdLine.toTokens());
                 break;
             }
         }
         else
         {
-            handleUnknownPacket(line);
+            handleUnknownPacket(fsdLine.toLineString());
         }
     }
 
@@ -15,12 +15,14 @@
 #include "blackcore/vatsim/vatsimsettings.h"
 #include "blackcore/fsd/enums.h"
 #include "blackcore/fsd/messagebase.h"
+#include "blackcore/fsd/fsdline.h"
 
 #include "blackmisc/simulation/ownaircraftprovider.h"
 #include "blackmisc/simulation/remoteaircraftprovider.h"
 #include "blackmisc/simulation/simulationenvironmentprovider.h"
 #include "blackmisc/aviation/atcstationlist.h"
 #include "blackmisc/aviation/callsign.h"
+#include "blackmisc/aviation/callsignid.h"
 #include "blackmisc/aviation/flightplan.h"
 #include "blackmisc/aviation/informationmessage.h"
 #include "blackmisc/aviation/aircrafticaocode.h"
@@ -49,6 +51,7 @@
 #include <QQueue>
 
 #include <atomic>
+#include <type_traits>
 
 //! Protocol version
 //! @{
@@ -61,6 +64,12 @@
 namespace BlackFsdTest { class CTestFSDClient; }
 namespace BlackCore::Fsd
 {
+    class PilotDataUpdate;
+    class InterimPilotDataUpdate;
+    class VisualPilotDataUpdate;
+    class VisualPilotDataPeriodic;
+    class VisualPilotDataStopped;
+
     //! Message groups
     enum class TextMessageGroups
     {
@@ -277,6 +286,7 @@ namespace BlackCore::Fsd
         //
         void sendMessageString(const QString &message);
         void sendQueuedMessage();
+        void enqueueMessageString(const QString &message, const QString &coalescingKey);
         //! @}
 
         //! Increase the statistics value for given identifier
@@ -295,7 +305,20 @@ namespace BlackCore::Fsd
                 this->sendDirectMessage(message);
                 return;
             }
-            m_queuedFsdMessages.enqueue(messageToFSDString(message));
+            this->enqueueMessageString(messageToFSDString(message), coalescingKey(message));
+        }
+
+        //! Key of messages superseded by a newer message of the same kind, empty if never superseded
+        //! \remark an older own position still waiting in the queue is outdated once a newer one is produced
+        template <class T>
+        static QString coalescingKey(const T &message)
+        {
+            if constexpr (std::is_same_v<T, PilotDataUpdate>) { return QStringLiteral("@"); }
+            else if constexpr (std::is_same_v<T, VisualPilotDataUpdate>) { return QStringLiteral("^"); }
+            else if constexpr (std::is_same_v<T, VisualPilotDataPeriodic>) { return QStringLiteral("#SL"); }
+            else if constexpr (std::is_same_v<T, VisualPilotDataStopped>) { return QStringLiteral("#ST"); }
+            else if constexpr (std::is_same_v<T, InterimPilotDataUpdate>) { return QStringLiteral("#SB:") % message.receiver(); }
+            else { Q_UNUSED(message); return {}; }
         }
 
         //! Message send to FSD
@@ -345,9 +368,22 @@ namespace BlackCore::Fsd
         void sendClientIdentification(const QString &fsdChallenge);
         void sendIncrementalAircraftConfig();
 
-        void readDataFromSocket() { this->readDataFromSocketMaxLines(); }
-        void readDataFromSocketMaxLines(int maxLines = -1);
+        //! Read socket data into the receive buffer and parse the lines
+        //! \remark parsing is limited by c_readBudgetUs per event loop turn, remaining lines are parsed in the next turn
+        //! @{
+        void readDataFromSocket();
+        void drainReceiveBuffer();
+        void scheduleDrainReceiveBuffer();
+        //! @}
+
+        //! Drop an incomplete line from the receive buffer, e.g. when the socket is switched
+        void discardIncompleteReceivedLine();
+
+        //! Clear the receive buffer
+        void clearReceiveBuffer();
+
         void parseMessage(const QString &lineRaw);
+        void parseMessage(const QByteArray &lineEncoded);
 
         QString socketErrorString(QAbstractSocket::SocketError error) const;
         static QString socketErrorToQString(QAbstractSocket::SocketError error);
@@ -367,7 +403,11 @@ namespace BlackCore::Fsd
         void handleDeletePilot(const QStringList &tokens);
         void handleTextMessage(const QStringList &tokens);
         void handlePilotDataUpdate(const QStringList &tokens);
+        void handlePilotDataUpdate(const FsdLine &tokens);
+        void handlePilotDataUpdate(const PilotDataUpdate &dataUpdate);
         void handleVisualPilotDataUpdate(const QStringList &tokens, MessageType messageType);
+        void handleVisualPilotDataUpdate(const FsdLine &tokens, MessageType messageType);
+        void handleVisualPilotDataUpdate(const VisualPilotDataUpdate &dataUpdate);
         void handleVisualPilotDataToggle(const QStringList &tokens);
         void handleEuroscopeSimData(const QStringList &tokens);
         void handlePing(const QStringList &tokens);
@@ -413,13 +453,13 @@ namespace BlackCore::Fsd
         void clearState(const BlackMisc::Aviation::CCallsign &callsign);
 
         //! Insert as first value
-        void insertLatestOffsetTime(const BlackMisc::Aviation::CCallsign &callsign, qint64 offsetMs);
+        void insertLatestOffsetTime(BlackMisc::Aviation::CCallsignId id, qint64 offsetMs);
 
         //! Average offset time in ms
-        qint64 averageOffsetTimeMs(const BlackMisc::Aviation::CCallsign &callsign, int &count, int maxLastValues = MaxOffseTimes) const;
+        qint64 averageOffsetTimeMs(BlackMisc::Aviation::CCallsignId id, int &count, int maxLastValues = MaxOffseTimes) const;
 
         //! Average offset time in ms
-        qint64 averageOffsetTimeMs(const BlackMisc::Aviation::CCallsign &callsign, int maxLastValues = MaxOffseTimes) const;
+        qint64 averageOffsetTimeMs(BlackMisc::Aviation::CCallsignId id, int maxLastValues = MaxOffseTimes) const;
 
         bool isInterimPositionSendingEnabledForServer() const;
         bool isInterimPositionReceivingEnabledForServer() const;
@@ -472,7 +512,7 @@ namespace BlackCore::Fsd
         qint64       m_loginSince = -1; //!< when login was triggered
         static constexpr qint64 PendingConnectionTimeoutMs = 7500;
 
-        // Parser
+        // Parser, the mapping is only used for statistics, see classifyMessageType
         QHash<QString, MessageType> m_messageTypeMapping;
 
         std::unique_ptr<QTcpSocket> m_socket = std::make_unique<QTcpSocket>(this); //!< used TCP socket, parent needed as it runs in worker thread
@@ -510,9 +550,9 @@ namespace BlackCore::Fsd
         };
 
         QHash<BlackMisc::Aviation::CCallsign, PendingAtisQuery> m_pendingAtisQueries;
-        QHash<BlackMisc::Aviation::CCallsign, qint64> m_lastPositionUpdate;
-        QHash<BlackMisc::Aviation::CCallsign, QList<qint64>> m_lastOffsetTimes; //!< latest offset first
-        QHash<BlackMisc::Aviation::CCallsign, qint64> m_interpolatedOffsetTime;
+        QHash<BlackMisc::Aviation::CCallsignId, qint64> m_lastPositionUpdate;
+        QHash<BlackMisc::Aviation::CCallsignId, QList<qint64>> m_lastOffsetTimes; //!< latest offset first
+        QHash<BlackMisc::Aviation::CCallsignId, qint64> m_interpolatedOffsetTime;
         static const int c_offsetTimeInterpolationInverseRate = 4;
 
         BlackMisc::Aviation::CAtcStationList m_atcStations;
@@ -567,7 +607,27 @@ namespace BlackCore::Fsd
         mutable QReadWriteLock m_lockUserClientBuffered { QReadWriteLock::Recursive }; //!< for user, client and buffered data
         QString getOwnCallsignAsString() const { QReadLocker l(&m_lockUserClientBuffered); return m_ownCallsign.asString(); }
 
-        QQueue<QString> m_queuedFsdMessages;
+        //! Queued message, already formatted
+        struct QueuedFsdMessage
+        {
+            QString message;       //!< FSD string incl. CR/LF
+            QString coalescingKey; //!< \sa coalescingKey
+        };
+
+        QQueue<QueuedFsdMessage> m_queuedFsdMessages;
+        QByteArray m_sendBuffer; //!< reused for all queued messages sent at once
+
+        // Receive buffer, m_receiveBufferOffset is the start of the first unparsed line
+        QByteArray m_receiveBuffer;
+        int        m_receiveBufferOffset = 0;
+        bool       m_drainScheduled = false;
+        qint64     m_receiveBacklogSinceMs = -1;        //!< since when complete lines are waiting
+        std::atomic_int    m_readBacklogBytes    { 0 };  //!< unparsed bytes after last drain
+        std::atomic_int    m_readBacklogLines    { 0 };  //!< unparsed lines after last drain
+        std::atomic_int    m_readMaxBacklogBytes { 0 };  //!< max. unparsed bytes
+        std::atomic_int    m_readDeferredDrains  { 0 };  //!< how often the budget was exceeded
+        std::atomic_llong  m_readLastLatencyMs   { 0 };  //!< time lines were waiting in the buffer
+        std::atomic_llong  m_readMaxLatencyMs    { 0 };  //!< max. time lines were waiting in the buffer
 
         //! An illegal FSD state has been detected
         void handleIllegalFsdState(const QString &message);
@@ -578,6 +638,9 @@ namespace BlackCore::Fsd
         static int constexpr c_updateInterimPostionIntervalMsec = 1000; //!< interval for iterim position updates (send our position as interim position)
         static int constexpr c_updateVisualPositionIntervalMsec = 200;  //!< interval for the VATSIM visual position updates (send our position and 6DOF velocity)
         static int constexpr c_sendFsdMsgIntervalMsec           = 10;   //!< interval for FSD send messages
+        static int constexpr c_sendFsdMsgMaxPerWrite            = 50;   //!< max. queued messages written at once
+        static int constexpr c_readBudgetUs                     = 4000; //!< time budget for parsing received lines per event loop turn
+        static int constexpr c_readChunkBytes                   = 64 * 1024; //!< max. bytes read from socket at once
         bool m_stoppedSendingVisualPositions = false; //!< for when velocity drops to zero
         bool m_serverWantsVisualPositions = false;    //!< there are interested clients in range
         unsigned m_visualPositionUpdateSentCount = 0; //!< for choosing when to send a periodic (slowfast) packet
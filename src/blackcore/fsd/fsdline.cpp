@@ -0,0 +1,211 @@
+/* Copyright (C) 2019
+ * swift project community / contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackcore/fsd/fsdline.h"
+
+#include <QtGlobal>
+#include <limits>
+
+namespace BlackCore::Fsd
+{
+    namespace
+    {
+        //! Two characters as one switch value
+        constexpr int pdu2(char c1, char c2)
+        {
+            return (static_cast<unsigned char>(c1) << 8) | static_cast<unsigned char>(c2);
+        }
+
+        //! ASCII whitespace as in QByteArray::trimmed
+        bool isSpace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+        }
+
+        //! Trim a range
+        void trimRange(const char *data, int &offset, int &length)
+        {
+            while (length > 0 && isSpace(data[offset])) { ++offset; --length; }
+            while (length > 0 && isSpace(data[offset + length - 1])) { --length; }
+        }
+
+        //! Parse an integer, QString::toInt like behaviour (invalid -> 0)
+        qlonglong parseInteger(const char *data, int length, qlonglong min, qlonglong max)
+        {
+            int offset = 0;
+            trimRange(data, offset, length);
+            if (length < 1) { return 0; }
+
+            const char *c = data + offset;
+            const char *end = c + length;
+            bool negative = false;
+            if (*c == '-' || *c == '+') { negative = (*c == '-'); ++c; }
+            if (c == end) { return 0; }
+
+            const qlonglong limit = negative ? -min : max;
+            qlonglong v = 0;
+            for (; c < end; ++c)
+            {
+                if (*c < '0' || *c > '9') { return 0; }
+                v = v * 10 + (*c - '0');
+                if (v > limit) { return 0; }
+            }
+            return negative ? -v : v;
+        }
+    }
+
+    MessageType classifyMessageType(const char *data, int size, int &prefixLength)
+    {
+        prefixLength = 0;
+        if (!data || size < 1) { return MessageType::Unknown; }
+
+        // single character PDUs
+        switch (data[0])
+        {
+        case '%': prefixLength = 1; return MessageType::AtcDataUpdate;
+        case '@': prefixLength = 1; return MessageType::PilotDataUpdate;
+        case '^': prefixLength = 1; return MessageType::VisualPilotDataUpdate;
+        default: break;
+        }
+
+        if (size < 2) { return MessageType::Unknown; }
+        if (data[0] == '!' && data[1] == 'R') { prefixLength = 2; return MessageType::RegistrationInfo; }
+        if (size >= 7 && data[0] == 'S' && qstrncmp(data, "SIMDATA", 7) == 0) { prefixLength = 7; return MessageType::EuroscopeSimData; }
+        if (size < 3) { return MessageType::Unknown; }
+
+        MessageType mt = MessageType::Unknown;
+        const int code = pdu2(data[1], data[2]);
+        switch (data[0])
+        {
+        case '#':
+            switch (code)
+            {
+            case pdu2('A', 'A'): mt = MessageType::AddAtc;                  break;
+            case pdu2('A', 'P'): mt = MessageType::AddPilot;                break;
+            case pdu2('D', 'A'): mt = MessageType::DeleteATC;               break;
+            case pdu2('D', 'P'): mt = MessageType::DeletePilot;             break;
+            case pdu2('P', 'C'): mt = MessageType::ProController;           break;
+            case pdu2('S', 'L'): mt = MessageType::VisualPilotDataPeriodic; break;
+            case pdu2('S', 'T'): mt = MessageType::VisualPilotDataStopped;  break;
+            case pdu2('D', 'L'): mt = MessageType::ServerHeartbeat;         break;
+            case pdu2('T', 'M'): mt = MessageType::TextMessage;             break;
+            case pdu2('S', 'B'): mt = MessageType::PilotClientCom;          break;
+            default: break;
+            }
+            break;
+        case '$':
+            switch (code)
+            {
+            case pdu2('Z', 'C'): mt = MessageType::AuthChallenge;         break;
+            case pdu2('Z', 'R'): mt = MessageType::AuthResponse;          break;
+            case pdu2('I', 'D'): mt = MessageType::ClientIdentification;  break;
+            case pdu2('C', 'Q'): mt = MessageType::ClientQuery;           break;
+            case pdu2('C', 'R'): mt = MessageType::ClientResponse;        break;
+            case pdu2('F', 'P'): mt = MessageType::FlightPlan;            break;
+            case pdu2('D', 'I'): mt = MessageType::FsdIdentification;     break;
+            case pdu2('!', '!'): mt = MessageType::KillRequest;           break;
+            case pdu2('S', 'F'): mt = MessageType::VisualPilotDataToggle; break;
+            case pdu2('P', 'I'): mt = MessageType::Ping;                  break;
+            case pdu2('P', 'O'): mt = MessageType::Pong;                  break;
+            case pdu2('E', 'R'): mt = MessageType::ServerError;           break;
+            case pdu2('X', 'X'): mt = MessageType::Rehost;                break;
+            default: break;
+            }
+            break;
+        case '-':
+            switch (code)
+            {
+            case pdu2('M', 'D'): mt = MessageType::RevBClientParts;      break;
+            case pdu2('P', 'D'): mt = MessageType::RevBPilotDescription; break;
+            default: break;
+            }
+            break;
+        default: break;
+        }
+
+        if (mt != MessageType::Unknown) { prefixLength = 3; }
+        return mt;
+    }
+
+    FsdLine::FsdLine(const QByteArray &line, QTextCodec *codec) :
+        m_line(line), m_codec(codec)
+    {
+        if (!m_codec) { m_codec = QTextCodec::codecForName("utf-8"); }
+
+        const char *data = m_line.constData();
+        m_lineOffset = 0;
+        m_lineLength = m_line.size();
+        trimRange(data, m_lineOffset, m_lineLength);
+
+        m_messageType = classifyMessageType(data + m_lineOffset, m_lineLength, m_prefixLength);
+        if (m_messageType == MessageType::Unknown) { return; }
+
+        m_payloadOffset = m_lineOffset + m_prefixLength;
+        m_payloadLength = m_lineLength - m_prefixLength;
+        trimRange(data, m_payloadOffset, m_payloadLength);
+        if (m_payloadLength < 1) { return; }
+
+        // split in place, same semantics as QString::split(':'), empty tokens are kept
+        int start = m_payloadOffset;
+        const int end = m_payloadOffset + m_payloadLength;
+        for (int i = m_payloadOffset; i <= end; ++i)
+        {
+            if (i < end && data[i] != ':') { continue; }
+            if (m_size >= MaxTokens) { m_truncated = true; break; }
+            m_spans[static_cast<size_t>(m_size++)] = { start, i - start };
+            start = i + 1;
+        }
+    }
+
+    QString FsdLine::toQString(int index) const
+    {
+        if (!this->isValidIndex(index)) { return {}; }
+        return m_codec->toUnicode(this->tokenData(index), m_spans[static_cast<size_t>(index)].length);
+    }
+
+    int FsdLine::toInt(int index) const
+    {
+        if (!this->isValidIndex(index)) { return 0; }
+        return static_cast<int>(parseInteger(this->tokenData(index), m_spans[static_cast<size_t>(index)].length,
+                                             std::numeric_limits<int>::min(), std::numeric_limits<int>::max()));
+    }
+
+    uint FsdLine::toUInt(int index) const
+    {
+        if (!this->isValidIndex(index)) { return 0; }
+        return static_cast<uint>(parseInteger(this->tokenData(index), m_spans[static_cast<size_t>(index)].length,
+                                              0, std::numeric_limits<uint>::max()));
+    }
+
+    double FsdLine::toDouble(int index) const
+    {
+        if (!this->isValidIndex(index)) { return 0.0; }
+        // QByteArray::toDouble copies the token into a zero terminated buffer, tokens are not terminated in the line
+        return QByteArray::fromRawData(this->tokenData(index), m_spans[static_cast<size_t>(index)].length).toDouble();
+    }
+
+    QByteArray FsdLine::toBytes(int index) const
+    {
+        if (!this->isValidIndex(index)) { return {}; }
+        return QByteArray(this->tokenData(index), m_spans[static_cast<size_t>(index)].length);
+    }
+
+    QStringList FsdLine::toTokens() const
+    {
+        if (m_payloadLength < 1) { return {}; }
+
+        // decode once and split, identical to the classic parser
+        const QString payload = m_codec->toUnicode(m_line.constData() + m_payloadOffset, m_payloadLength);
+        return payload.split(':');
+    }
+
+    QString FsdLine::toLineString() const
+    {
+        return m_codec->toUnicode(m_line.constData() + m_lineOffset, m_lineLength);
+    }
+} // ns
@@ -0,0 +1,112 @@
+/* Copyright (C) 2019
+ * swift project community / contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKCORE_FSD_FSDLINE_H
+#define BLACKCORE_FSD_FSDLINE_H
+
+#include "blackcore/blackcoreexport.h"
+#include "blackcore/fsd/messagebase.h"
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+#include <QTextCodec>
+#include <array>
+
+namespace BlackCore::Fsd
+{
+    //! Classify the PDU prefix of a raw FSD line
+    //! \param data          raw line, leading whitespace already removed
+    //! \param size          size of data
+    //! \param prefixLength  length of the detected PDU prefix, 0 if unknown
+    //! \remark switch based, replaces the linear startsWith scan over all known prefixes
+    BLACKCORE_EXPORT MessageType classifyMessageType(const char *data, int size, int &prefixLength);
+
+    //! A received FSD line split into tokens without copying
+    //! \remark The tokens are spans over the raw (encoded) line, only the fields actually used
+    //!         by a handler are converted. toTokens() provides the classic QStringList.
+    class BLACKCORE_EXPORT FsdLine
+    {
+    public:
+        //! Max. number of tokens kept as spans
+        static constexpr int MaxTokens = 32;
+
+        //! Constructor
+        //! \param line   raw line as read from the socket, including CR/LF
+        //! \param codec  codec to decode string fields, UTF-8 if null
+        FsdLine(const QByteArray &line, QTextCodec *codec);
+
+        //! Message type as detected from prefix
+        MessageType messageType() const { return m_messageType; }
+
+        //! Length of the PDU prefix
+        int prefixLength() const { return m_prefixLength; }
+
+        //! Any payload after the prefix?
+        bool hasPayload() const { return m_payloadLength > 0; }
+
+        //! Number of tokens
+        int size() const { return m_size; }
+
+        //! More than MaxTokens tokens?
+        //! \remark in that case only toTokens() returns all of them
+        bool isTruncated() const { return m_truncated; }
+
+        //! Token as string, decoded with the codec
+        QString toQString(int index) const;
+
+        //! Token as integer, 0 if empty or invalid (as QString::toInt)
+        int toInt(int index) const;
+
+        //! Token as unsigned integer, 0 if empty or invalid (as QString::toUInt)
+        uint toUInt(int index) const;
+
+        //! Token as double, 0 if empty or invalid (as QString::toDouble)
+        double toDouble(int index) const;
+
+        //! Token as raw bytes (copy)
+        QByteArray toBytes(int index) const;
+
+        //! All tokens as string list
+        //! \remark compatibility with the handle*(const QStringList &) functions
+        QStringList toTokens() const;
+
+        //! The trimmed line decoded as string (e.g. for logging)
+        QString toLineString() const;
+
+    private:
+        //! Token span, offset and length in the raw line
+        struct Span
+        {
+            int offset = 0;
+            int length = 0;
+        };
+
+        //! Token data
+        const char *tokenData(int index) const { return m_line.constData() + m_spans[static_cast<size_t>(index)].offset; }
+
+        //! Valid token index?
+        bool isValidIndex(int index) const { return index >= 0 && index < m_size; }
+
+        QByteArray   m_line;
+        QTextCodec  *m_codec = nullptr;
+        MessageType  m_messageType = MessageType::Unknown;
+        int          m_lineOffset    = 0; //!< start of trimmed line
+        int          m_lineLength    = 0; //!< length of trimmed line
+        int          m_prefixLength  = 0;
+        int          m_payloadOffset = 0;
+        int          m_payloadLength = 0;
+        int          m_size = 0;
+        bool         m_truncated = false;
+        std::array<Span, MaxTokens> m_spans;
+    };
+} // ns
+
+#endif // guard
@@ -75,4 +75,24 @@ namespace BlackCore::Fsd
                 tokens[4].toDouble(), tokens[5].toDouble(), tokens[6].toInt(), tokens[6].toInt() + tokens[9].toInt(), tokens[7].toInt(),
                 pitch, bank, heading, onGround);
     }
+
+    PilotDataUpdate PilotDataUpdate::fromTokens(const FsdLine &tokens)
+    {
+        if (tokens.size() < 10)
+        {
+            CLogMessage(static_cast<PilotDataUpdate *>(nullptr)).debug(u"Wrong number of arguments.");
+            return {};
+        }
+
+        double pitch = 0.0;
+        double bank  = 0.0;
+        double heading = 0.0;
+        bool onGround = false;
+        unpackPBH(tokens.toUInt(8), pitch, bank, heading, onGround);
+
+        const int altitudeTrue = tokens.toInt(6);
+        return PilotDataUpdate(fromQString<CTransponder::TransponderMode>(tokens.toQString(0)), tokens.toQString(1), tokens.toInt(2), fromQString<PilotRating>(tokens.toQString(3)),
+                tokens.toDouble(4), tokens.toDouble(5), altitudeTrue, altitudeTrue + tokens.toInt(9), tokens.toInt(7),
+                pitch, bank, heading, onGround);
+    }
 }
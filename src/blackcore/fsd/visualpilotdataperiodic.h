@@ -13,6 +13,7 @@
 
 #include "messagebase.h"
 #include "enums.h"
+#include "fsdline.h"
 
 namespace BlackCore::Fsd
 {
@@ -33,6 +34,9 @@ namespace BlackCore::Fsd
         //! Construct from tokens
         static VisualPilotDataPeriodic fromTokens(const QStringList &tokens);
 
+        //! Construct from tokens of a raw line, only converting the used fields
+        static VisualPilotDataPeriodic fromTokens(const FsdLine &tokens);
+
         //! PDU identifier
         static QString pdu() { return "#SL"; }
 
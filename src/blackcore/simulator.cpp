@@ -382,6 +382,46 @@ namespace BlackCore
         return setup;
     }
 
+    QVector<CInterpolationAndRenderingSetupPerCallsign> ISimulator::getInterpolationSetupsConsolidated(const QVector<CCallsign> &callsigns, bool forceFullUpdate) const
+    {
+        QVector<CInterpolationAndRenderingSetupPerCallsign> setups = this->getInterpolationSetupsPerCallsignOrDefault(callsigns);
+        if (setups.isEmpty()) { return setups; }
+
+        // one copy of all clients instead of one lookup per callsign
+        const CClientList clients = this->getClients();
+        QHash<CCallsign, int> clientIndexes;
+        clientIndexes.reserve(clients.size());
+        for (int i = 0; i < clients.size(); ++i) { clientIndexes.insert(clients[i].getCallsign(), i); }
+
+        static const CClient noClient;
+        for (int s = 0; s < setups.size(); ++s)
+        {
+            CInterpolationAndRenderingSetupPerCallsign &setup = setups[s];
+            const int c = clientIndexes.value(callsigns[s], -1);
+            setup.consolidateWithClient(c < 0 ? noClient : clients[c]);
+            if (forceFullUpdate) { setup.setForceFullInterpolation(forceFullUpdate); }
+        }
+        return setups;
+    }
+
+    QVector<CInterpolationResult> ISimulator::interpolateRemoteAircraft(const QVector<CCallsign> &callsigns, const QVector<CInterpolatorMulti *> &interpolators, qint64 currentTimestamp, bool forceFullUpdate)
+    {
+        Q_ASSERT_X(callsigns.size() == interpolators.size(), Q_FUNC_INFO, "Need one interpolator per callsign");
+        const int n = callsigns.size();
+        QVector<CInterpolationResult> results(n);
+        if (n < 1) { return results; }
+
+        // each interpolator checks whether the situations of its callsign were modified by the callsign identifier
+        const QVector<CInterpolationAndRenderingSetupPerCallsign> setups = this->getInterpolationSetupsConsolidated(callsigns, forceFullUpdate);
+        for (int i = 0; i < n; ++i)
+        {
+            CInterpolatorMulti *interpolator = interpolators[i];
+            if (!interpolator) { continue; }
+            results[i] = interpolator->getInterpolation(currentTimestamp, setups[i], i);
+        }
+        return results;
+    }
+
     bool ISimulator::requestElevation(const ICoordinateGeodetic &reference, const CCallsign &callsign)
     {
         Q_UNUSED(reference)
@@ -824,6 +864,7 @@ namespace BlackCore
         if (snapshot.isRenderingEnabled())
         {
             // make sure not to add aircraft again which are no longer in range
+            // always all aircraft, so aircraft missed or failed before are added or removed again
             const CCallsignSet callsignsInRange = this->getAircraftInRangeCallsigns();
             const CCallsignSet callsignsEnabledAndStillInRange = snapshot.getEnabledAircraftCallsignsByDistance().intersection(callsignsInRange);
             const CCallsignSet callsignsInSimulator(this->physicallyRenderedAircraft()); // state in simulator
@@ -1027,10 +1068,8 @@ namespace BlackCore
         if (this->isShuttingDown()) { return CAirportList(); }
         if (!sApp || !sApp->hasWebDataServices()) { return CAirportList(); }
 
-        const CAirportList airports = sApp->getWebDataServices()->getAirports();
-        if (airports.isEmpty()) { return airports; }
         const CCoordinateGeodetic ownPosition = this->getOwnAircraftPosition();
-        CAirportList airportsInRange = airports.findClosest(maxAirportsInRange(), ownPosition);
+        CAirportList airportsInRange = sApp->getWebDataServices()->getAirportsClosest(maxAirportsInRange(), ownPosition);
         if (recalculateDistance) { airportsInRange.calculcateAndUpdateRelativeDistanceAndBearing(this->getOwnAircraftPosition()); }
         return airportsInRange;
     }
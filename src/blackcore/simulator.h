@@ -310,6 +310,22 @@ namespace BlackCore
         //! \threadsafe
         BlackMisc::Simulation::CInterpolationAndRenderingSetupPerCallsign getInterpolationSetupConsolidated(const BlackMisc::Aviation::CCallsign &callsign, bool forceFullUpdate) const;
 
+        //! Consolidated setups for many callsigns, same order as callsigns
+        //! \remark setups and clients are fetched once for all callsigns
+        //! \threadsafe
+        QVector<BlackMisc::Simulation::CInterpolationAndRenderingSetupPerCallsign> getInterpolationSetupsConsolidated(const QVector<BlackMisc::Aviation::CCallsign> &callsigns, bool forceFullUpdate) const;
+
+        //! Interpolate remote aircraft for one timestamp
+        //! \remark the setups are consolidated once for all aircraft, each aircraft is then interpolated by its own interpolator
+        //! \param callsigns         aircraft to be interpolated
+        //! \param interpolators     interpolator of each aircraft, same order as callsigns, nullptr gives an empty result
+        //! \param currentTimestamp  interpolation time
+        //! \param forceFullUpdate   \sa getInterpolationSetupConsolidated
+        //! \return one result per callsign, same order as callsigns
+        QVector<BlackMisc::Simulation::CInterpolationResult> interpolateRemoteAircraft(
+            const QVector<BlackMisc::Aviation::CCallsign> &callsigns, const QVector<BlackMisc::Simulation::CInterpolatorMulti *> &interpolators,
+            qint64 currentTimestamp, bool forceFullUpdate);
+
         //! \copydoc BlackMisc::Simulation::IInterpolationSetupProvider::setInterpolationSetupGlobal
         virtual bool setInterpolationSetupGlobal(const BlackMisc::Simulation::CInterpolationAndRenderingSetupGlobal &setup) override;
 
@@ -52,6 +52,7 @@ using namespace BlackMisc::Simulation;
 using namespace BlackMisc::Network;
 using namespace BlackMisc::Aviation;
 using namespace BlackMisc::Weather;
+using namespace BlackMisc::Geo;
 
 namespace BlackCore
 {
@@ -860,6 +861,12 @@ namespace BlackCore
         return CAirportList();
     }
 
+    CAirportList CWebDataServices::getAirportsClosest(int number, const ICoordinateGeodetic &position) const
+    {
+        if (m_airportDataReader) { return m_airportDataReader->getAirportsClosest(number, position); }
+        return CAirportList();
+    }
+
     int CWebDataServices::getAirportsCount() const
     {
         if (m_airportDataReader) { return m_airportDataReader->getAirportsCount(); }
@@ -1335,6 +1342,7 @@ namespace BlackCore
     void CWebDataServices::readFromSwiftReader(CEntityFlags::Entity entities, CEntityFlags::ReadState state, int number, const QUrl &url)
     {
         if (state == CEntityFlags::ReadStarted) { return; } // just started
+        if (state == CEntityFlags::ReadParsing && number > 0) { return; } // parsing progress
 
         const QString from   = url.isEmpty() ? QStringLiteral("") : QStringLiteral(" from '%1'").arg(url.toString());
         const QString entStr = CEntityFlags::flagToString(entities);
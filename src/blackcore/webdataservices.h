@@ -369,6 +369,10 @@ namespace BlackCore
         //! \threadsafe
         int getAirportsCount() const;
 
+        //! Get closest airports, closest first
+        //! \threadsafe
+        BlackMisc::Aviation::CAirportList getAirportsClosest(int number, const BlackMisc::Geo::ICoordinateGeodetic &position) const;
+
         //! Get airport for ICAO designator
         //! \threadsafe
         BlackMisc::Aviation::CAirport getAirportForIcaoDesignator(const QString &icao) const;
@@ -20,6 +20,7 @@
 #include "blackmisc/slot.h"
 
 #include <QDirIterator>
+#include <QFileInfo>
 #include <QFileInfoList>
 #include <QFileSystemModel>
 #include <QDir>
@@ -181,8 +182,14 @@ namespace BlackGui::Components
                     m_lastServer.getFilename(),
                     m_lastAircraftModel.getFilename()
                 });
-                cf.append(m_modelSetCaches.getAllFilenames());
-                cf.append(m_modelCaches.getAllFilenames());
+                // model caches are saved in binary files, other versions use JSON files
+                const QStringList modelCacheFiles = m_modelSetCaches.getAllFilenames() + m_modelCaches.getAllFilenames();
+                for (const QString &modelCacheFile : modelCacheFiles)
+                {
+                    const QFileInfo fi(modelCacheFile);
+                    cf.push_back(CFileUtils::appendFilePaths(fi.path(), fi.completeBaseName() + ".bin"));
+                    cf.push_back(CFileUtils::appendFilePaths(fi.path(), fi.completeBaseName() + ".json"));
+                }
                 return CFileUtils::getFileNamesOnly(cf);
             }();
             if (!m_withBootstrapFile) { return cacheFilter; }
@@ -14,6 +14,7 @@
 #include "blackmisc/fileutils.h"
 #include "blackmisc/swiftdirectories.h"
 #include "blackmisc/directoryutils.h"
+#include "blackmisc/simulation/aircraftmodellistbinary.h"
 
 #include <QSet>
 #include <QPointer>
@@ -131,7 +132,15 @@ namespace BlackGui::Components
         if (relativeModelFile.length() < 2) { return false; }
         relativeModelFile = relativeModelFile.mid(relativeModelFile.indexOf('/', 1));
 
-        const QString otherModelFile = CFileUtils::appendFilePathsAndFixUnc(otherVersion.getApplicationDataDirectory(), relativeModelFile);
+        QString otherModelFile = CFileUtils::appendFilePathsAndFixUnc(otherVersion.getApplicationDataDirectory(), relativeModelFile);
+        {
+            // other versions save the models in a binary or in a JSON file, a JSON file next to a binary file is outdated
+            const QFileInfo fi(otherModelFile);
+            const QString binaryFile = CFileUtils::appendFilePaths(fi.path(), fi.completeBaseName() + ".bin");
+            const QString jsonFile = CFileUtils::appendFilePaths(fi.path(), fi.completeBaseName() + ".json");
+            if (QFileInfo::exists(binaryFile)) { otherModelFile = binaryFile; }
+            else if (QFileInfo::exists(jsonFile)) { otherModelFile = jsonFile; }
+        }
         const QFileInfo fiOtherModelFile(otherModelFile);
         if (!fiOtherModelFile.exists())
         {
@@ -140,6 +149,20 @@ namespace BlackGui::Components
         }
 
         // read other file
+        if (fiOtherModelFile.suffix() == "bin")
+        {
+            CStatusMessage msg;
+            models = CAircraftModelListBinary::fromFile(fiOtherModelFile.absoluteFilePath(), msg);
+            if (msg.isFailure())
+            {
+                this->showOverlayMessage(msg);
+                return false;
+            }
+            ui->tvp_AircraftModels->updateContainerAsync(models);
+            ui->le_Status->setText(QStringLiteral("Imported %1 models '%2' for %3").arg(models.size()).arg(fiOtherModelFile.fileName(), sim.toQString()));
+            return true;
+        }
+
         const QString jsonString = CFileUtils::readFileToString(fiOtherModelFile.absoluteFilePath());
         if (jsonString.isEmpty()) { return false; }
         try
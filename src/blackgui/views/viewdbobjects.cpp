@@ -112,8 +112,11 @@ namespace BlackGui::Views
     {
         if (container.isEmpty()) { return 0; }
         ContainerType copy(this->container());
-        int c = copy.replaceOrAddObjectsByKey(container);
-        if (c == 0) { return 0; }
+        int updated = 0;
+        int added = 0;
+        int removed = 0;
+        const int c = copy.replaceOrAddObjectsByKey(container, &updated, &added, &removed);
+        if (updated + added + removed == 0) { return 0; } // nothing changed
         this->updateContainerMaybeAsync(copy);
         return c;
     }
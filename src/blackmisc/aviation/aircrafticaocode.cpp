@@ -147,7 +147,7 @@ namespace BlackMisc::Aviation
             else if (this->getRank() < 10) { score += (10 - this->getRank()); }
             if (score > scoreOld)
             {
-                addLogDetailsToList(log, *this, QStringLiteral("Added rank: %1").arg(score));
+                if (log) { addLogDetailsToList(log, *this, QStringLiteral("Added rank: %1").arg(score)); }
             }
         }
         else
@@ -155,12 +155,12 @@ namespace BlackMisc::Aviation
             if (this->hasFamily() && this->getFamily() == otherCode.getFamily())
             {
                 score += 40;
-                addLogDetailsToList(log, *this, QStringLiteral("Added family: %1").arg(score));
+                if (log) { addLogDetailsToList(log, *this, QStringLiteral("Added family: %1").arg(score)); }
             }
             else if (this->hasValidCombinedType() && otherCode.getCombinedType() == this->getCombinedType())
             {
                 score += 30;
-                addLogDetailsToList(log, *this, QStringLiteral("Added combined code: %1").arg(score));
+                if (log) { addLogDetailsToList(log, *this, QStringLiteral("Added combined code: %1").arg(score)); }
             }
             else if (this->hasValidCombinedType())
             {
@@ -203,7 +203,7 @@ namespace BlackMisc::Aviation
                 {
                     score += 4;
                 }
-                addLogDetailsToList(log, *this, QStringLiteral("Added combined code parts: %1").arg(score));
+                if (log) { addLogDetailsToList(log, *this, QStringLiteral("Added combined code parts: %1").arg(score)); }
             }
         }
 
@@ -213,11 +213,11 @@ namespace BlackMisc::Aviation
             if (this->matchesManufacturer(otherCode.getManufacturer()))
             {
                 score += 10;
-                addLogDetailsToList(log, *this, QStringLiteral("Matches manufacturer '%1': %2").arg(this->getManufacturer()).arg(score));
+                if (log) { addLogDetailsToList(log, *this, QStringLiteral("Matches manufacturer '%1': %2").arg(this->getManufacturer()).arg(score)); }
             }
             else if (this->getManufacturer().contains(otherCode.getManufacturer(), Qt::CaseInsensitive))
             {
-                addLogDetailsToList(log, *this, QStringLiteral("Contains manufacturer '%1': %2").arg(this->getManufacturer()).arg(score));
+                if (log) { addLogDetailsToList(log, *this, QStringLiteral("Contains manufacturer '%1': %2").arg(this->getManufacturer()).arg(score)); }
                 score += 5;
             }
         }
@@ -226,12 +226,12 @@ namespace BlackMisc::Aviation
         if (this->hasCategory() && otherCode.hasCategory() && this->getCategory() == otherCode.getCategory())
         {
             score += 8;
-            addLogDetailsToList(log, *this, QStringLiteral("Matches military flag '%1': %2").arg(boolToYesNo(this->isMilitary())).arg(score));
+            if (log) { addLogDetailsToList(log, *this, QStringLiteral("Matches military flag '%1': %2").arg(boolToYesNo(this->isMilitary())).arg(score)); }
         }
         else if (this->isMilitary() == otherCode.isMilitary())
         {
             score += 8;
-            addLogDetailsToList(log, *this, QStringLiteral("Matches military flag '%1': %2").arg(boolToYesNo(this->isMilitary())).arg(score));
+            if (log) { addLogDetailsToList(log, *this, QStringLiteral("Matches military flag '%1': %2").arg(boolToYesNo(this->isMilitary())).arg(score)); }
         }
         // 0..85
         return score;
@@ -9,9 +9,11 @@
 #include "blackmisc/aviation/aircrafticaocodelist.h"
 #include "blackmisc/aviation/aircraftcategorylist.h"
 #include "blackmisc/setbuilder.h"
+#include "blackmisc/threadutils.h"
 
 #include <QJsonValue>
 #include <Qt>
+#include <vector>
 
 BLACK_DEFINE_SEQUENCE_MIXINS(BlackMisc::Aviation, CAircraftIcaoCode, CAircraftIcaoCodeList)
 
@@ -324,41 +326,57 @@ namespace BlackMisc::Aviation
         return { pair.first, pair.second };
     }
 
-    CAircraftIcaoCodeList CAircraftIcaoCodeList::fromDatabaseJson(const QJsonArray &array, const CAircraftCategoryList &categories, bool ignoreIncompleteAndDuplicates, CAircraftIcaoCodeList *inconsistent)
+    CAircraftIcaoCodeList CAircraftIcaoCodeList::fromDatabaseJson(const QJsonArray &array, const CAircraftCategoryList &categories, bool ignoreIncompleteAndDuplicates, CAircraftIcaoCodeList *inconsistent, const std::function<void(int)> &progress)
     {
-        CAircraftIcaoCodeList codes;
-        for (const QJsonValue &value : array)
+        const AircraftCategoryIdMap categoriesMap = categories.toDbKeyValueMap();
+
+        constexpr int MinCodesPerThread = 2048;
+        const int n = array.size();
+        const int chunks = parallelChunkCount(n, MinCodesPerThread);
+        std::vector<CAircraftIcaoCodeList> chunkCodes(static_cast<size_t>(chunks));
+        std::vector<CAircraftIcaoCodeList> chunkInconsistent(static_cast<size_t>(chunks));
+        forEachChunkParallel(n, chunks, [&](int c, int from, int to)
         {
-            CAircraftIcaoCode icao(CAircraftIcaoCode::fromDatabaseJson(value.toObject()));
-            const int catId = icao.getCategory().getDbKey();
-            if (!categories.isEmpty() && catId >= 0)
+            const QJsonArray chunkArray(array); // own copy, only reentrant
+            CAircraftIcaoCodeList &codes = chunkCodes[static_cast<size_t>(c)];
+            CAircraftIcaoCodeList &inconsistentCodes = chunkInconsistent[static_cast<size_t>(c)];
+            for (int i = from; i < to; ++i)
             {
-                const CAircraftCategory category = categories.findByKey(catId);
-                if (!category.isNull())
+                CAircraftIcaoCode icao(CAircraftIcaoCode::fromDatabaseJson(chunkArray.at(i).toObject()));
+                const int catId = icao.getCategory().getDbKey();
+                if (catId >= 0)
                 {
-                    icao.setCategory(category);
+                    const auto category = categoriesMap.constFind(catId);
+                    if (category != categoriesMap.cend()) { icao.setCategory(*category); }
                 }
-            }
 
-            if (!icao.hasSpecialDesignator() && !icao.hasCompleteData())
-            {
-                if (ignoreIncompleteAndDuplicates) { continue; }
-                if (inconsistent)
+                if (!icao.hasSpecialDesignator() && !icao.hasCompleteData())
                 {
-                    inconsistent->push_back(icao);
-                    continue;
+                    if (ignoreIncompleteAndDuplicates) { continue; }
+                    if (inconsistent)
+                    {
+                        inconsistentCodes.push_back(icao);
+                        continue;
+                    }
                 }
-            }
-            if (icao.isDbDuplicate())
-            {
-                if (ignoreIncompleteAndDuplicates) { continue; }
-                if (inconsistent)
+                if (icao.isDbDuplicate())
                 {
-                    inconsistent->push_back(icao);
-                    continue;
+                    if (ignoreIncompleteAndDuplicates) { continue; }
+                    if (inconsistent)
+                    {
+                        inconsistentCodes.push_back(icao);
+                        continue;
+                    }
                 }
+                codes.push_back(icao);
             }
-            codes.push_back(icao);
+        }, progress);
+
+        CAircraftIcaoCodeList codes;
+        for (int c = 0; c < chunks; ++c)
+        {
+            codes.push_back(std::move(chunkCodes[static_cast<size_t>(c)]));
+            if (inconsistent) { inconsistent->push_back(std::move(chunkInconsistent[static_cast<size_t>(c)])); }
         }
         return codes;
     }
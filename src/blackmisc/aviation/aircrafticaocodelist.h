@@ -20,6 +20,7 @@
 #include <QJsonArray>
 #include <QMetaType>
 #include <QStringList>
+#include <functional>
 #include <tuple>
 
 BLACK_DECLARE_SEQUENCE_MIXINS(BlackMisc::Aviation, CAircraftIcaoCode, CAircraftIcaoCodeList)
@@ -143,7 +144,8 @@ namespace BlackMisc::Aviation
         QPair<QString, int> maxCountManufacturer() const;
 
         //! From our database JSON format
-        static CAircraftIcaoCodeList fromDatabaseJson(const QJsonArray &array, const CAircraftCategoryList &categories, bool ignoreIncompleteAndDuplicates = true, CAircraftIcaoCodeList *inconsistent = nullptr);
+        //! \remark large arrays are converted in parallel chunks, progress is called with the number of converted codes
+        static CAircraftIcaoCodeList fromDatabaseJson(const QJsonArray &array, const CAircraftCategoryList &categories, bool ignoreIncompleteAndDuplicates = true, CAircraftIcaoCodeList *inconsistent = nullptr, const std::function<void(int)> &progress = {});
     };
 } // namespace
 
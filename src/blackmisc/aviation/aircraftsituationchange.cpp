@@ -8,6 +8,7 @@
 
 #include "blackmisc/aviation/aircraftsituationchange.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
+#include "blackmisc/aviation/aircraftsituationrunningstatistics.h"
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/simulation/aircraftmodel.h"
 #include "blackmisc/pq/length.h"
@@ -88,6 +89,62 @@ namespace BlackMisc::Aviation
         }
     }
 
+    CAircraftSituationChange::CAircraftSituationChange(const CAircraftSituationList &situations, const CAircraftSituationRunningStatistics &statistics, const CLength &cg, bool isVtol)
+    {
+        const int n = situations.size();
+        if (n < 2) { return; }
+        Q_ASSERT_X(statistics.size() == n, Q_FUNC_INFO, "Statistics do not match situations");
+
+        if (CBuildConfig::isLocalDeveloperDebugBuild())
+        {
+            Q_ASSERT_X(situations.isSortedAdjustedLatestFirstWithoutNullPositions(), Q_FUNC_INFO, "Wrong sort order or NULL position");
+        }
+
+        const CAircraftSituation &latest = situations.front();
+        const CAircraftSituation &oldest = situations.back();
+
+        m_situationsCount = n;
+        m_correspondingCallsign = latest.getCallsign();
+        m_timestampMSecsSinceEpoch = latest.getMSecsSinceEpoch();
+        m_timeOffsetMs = latest.getTimeOffsetMs();
+        m_oldestTimestampMSecsSinceEpoch = oldest.getMSecsSinceEpoch();
+        m_latestAdjustedTimestampMSecsSinceEpoch = latest.getAdjustedMSecsSinceEpoch();
+        m_oldestAdjustedTimestampMSecsSinceEpoch = oldest.getAdjustedMSecsSinceEpoch();
+        m_constAscending = statistics.isConstAscending();
+        m_constDescending = statistics.isConstDescending();
+        m_constAccelerating = statistics.isConstAccelerating();
+        m_constDecelerating = statistics.isConstDecelerating();
+        m_containsPushBack = !isVtol && statistics.containsPushBack();
+
+        // ground flags can be changed after a situation was stored, so they are counted here (one pass, no copies)
+        int onGround = 0;
+        int notOnGround = 0;
+        int nullPositions = 0;
+        for (int i = 1; i < n; ++i)
+        {
+            const CAircraftSituation &s = situations[i];
+            const CAircraftSituation::IsOnGround og = s.getOnGround();
+            if (og == CAircraftSituation::OnGround) { onGround++; }
+            else if (og == CAircraftSituation::NotOnGround) { notOnGround++; }
+            if (s.isNull() || s.isGeodeticHeightNull()) { nullPositions++; }
+        }
+        const CAircraftSituation::IsOnGround latestOg = latest.getOnGround();
+        const bool latestNull = latest.isNull() || latest.isGeodeticHeightNull();
+        const int others = n - 1;
+        m_constOnGround = !latestNull && nullPositions == 0 && latestOg == CAircraftSituation::OnGround && onGround == others;
+        m_constNotOnGround = !latestNull && nullPositions == 0 && latestOg == CAircraftSituation::NotOnGround && notOnGround == others;
+        m_justTakeoff = latestOg == CAircraftSituation::NotOnGround && onGround == others;
+        m_justTouchdown = latestOg == CAircraftSituation::OnGround && notOnGround == others;
+        if (n >= 3)
+        {
+            m_wasNotOnGround = nullPositions == 0 && notOnGround == others;
+            m_wasOnGround = nullPositions == 0 && onGround == others;
+        }
+
+        this->calculateStdDeviations(statistics, cg);
+        m_rotateUp = latest.getPitch() > (m_pitchMean + m_pitchStdDev);
+    }
+
     bool CAircraftSituationChange::guessOnGround(CAircraftSituation &situation, const Simulation::CAircraftModel &model) const
     {
         if (!situation.shouldGuessOnGround()) { return false; }
@@ -374,6 +431,46 @@ namespace BlackMisc::Aviation
         return true;
     }
 
+    bool CAircraftSituationChange::calculateStdDeviations(const CAircraftSituationRunningStatistics &statistics, const CLength &cg)
+    {
+        if (statistics.size() < 1) { return false; }
+
+        const CSpeedPair gsStdDevMean = statistics.groundSpeedStandardDeviationAndMean();
+        m_gsStdDev = gsStdDevMean.first;
+        m_gsMean = gsStdDevMean.second;
+
+        const CAnglePair pitchStdDevMean = statistics.pitchStandardDeviationAndMean();
+        m_pitchStdDev = pitchStdDevMean.first;
+        m_pitchMean = pitchStdDevMean.second;
+
+        const CAltitudePair altStdDevMean = statistics.altitudeStandardDeviationAndMean();
+        if (!altStdDevMean.first.isNull())
+        {
+            m_altStdDev = altStdDevMean.first;
+            m_altMean = altStdDevMean.second;
+        }
+
+        const CAltitudePair elvStdDevMean = statistics.elevationStandardDeviationAndMean();
+        if (!elvStdDevMean.first.isNull())
+        {
+            m_elvStdDev = elvStdDevMean.first;
+            m_elvMean = elvStdDevMean.second;
+
+            const CLengthPair gndDistanceStdDevMean = statistics.groundDistanceStandardDeviationAndMean();
+            if (!gndDistanceStdDevMean.first.isNull())
+            {
+                m_gndDistStdDev = gndDistanceStdDevMean.first;
+                m_gndDistMean = gndDistanceStdDevMean.second;
+
+                const CLengthPair gndDistMinMax = statistics.minMaxGroundDistance();
+                m_minGroundDistance = gndDistMinMax.first;
+                m_maxGroundDistance = gndDistMinMax.second;
+                this->guessSceneryDeviation(cg);
+            }
+        }
+        return true;
+    }
+
     const CAircraftSituationChange &CAircraftSituationChange::null()
     {
         static const CAircraftSituationChange null;
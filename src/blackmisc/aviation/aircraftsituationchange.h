@@ -33,6 +33,7 @@ namespace BlackMisc
     {
         class CAircraftSituation;
         class CAircraftSituationList;
+        class CAircraftSituationRunningStatistics;
 
         //! Value object about changes in situations
         class BLACKMISC_EXPORT CAircraftSituationChange :
@@ -76,6 +77,11 @@ namespace BlackMisc
             //! \remark the timestamps of the latest situation will be used
             CAircraftSituationChange(const CAircraftSituationList &situations, const PhysicalQuantities::CLength &cg, bool isVtol, bool alreadySortedLatestFirst = false, bool calcStdDeviations = false);
 
+            //! Ctor with n situations and their running statistics, standard deviations are always set
+            //! \remark situations sorted latest first, statistics built from exactly these situations
+            //! \remark avoids the list based calculations, only the ground flags are checked per situation
+            CAircraftSituationChange(const CAircraftSituationList &situations, const CAircraftSituationRunningStatistics &statistics, const PhysicalQuantities::CLength &cg, bool isVtol);
+
             //! Get callsign
             const CCallsign &getCallsign() const { return m_correspondingCallsign; }
 
@@ -180,6 +186,9 @@ namespace BlackMisc
             //! Calculate the standard deviiations
             bool calculateStdDeviations(const CAircraftSituationList &situations, const PhysicalQuantities::CLength &cg);
 
+            //! Standard deviations from running statistics
+            bool calculateStdDeviations(const CAircraftSituationRunningStatistics &statistics, const PhysicalQuantities::CLength &cg);
+
             //! NULL object
             static const CAircraftSituationChange &null();
 
@@ -0,0 +1,248 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/aviation/aircraftsituationrunningstatistics.h"
+#include "blackmisc/aviation/aircraftsituationlist.h"
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/pq/units.h"
+
+#include <QtGlobal>
+#include <cmath>
+#include <limits>
+
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Aviation
+{
+    void CAircraftSituationRunningStatistics::RunningValue::add(double value)
+    {
+        n++;
+        const double delta = value - mean;
+        mean += delta / n;
+        m2 += delta * (value - mean);
+    }
+
+    void CAircraftSituationRunningStatistics::RunningValue::remove(double value)
+    {
+        if (n <= 1) { *this = RunningValue(); return; }
+        const double delta = value - mean;
+        const double newMean = mean - delta / (n - 1);
+        m2 -= delta * (value - newMean);
+        if (m2 < 0.0) { m2 = 0.0; } // rounding
+        mean = newMean;
+        n--;
+    }
+
+    double CAircraftSituationRunningStatistics::RunningValue::standardDeviation() const
+    {
+        if (n < 1) { return 0.0; }
+        return std::sqrt(m2 / n);
+    }
+
+    void CAircraftSituationRunningStatistics::addLatest(const CAircraftSituation &situation, int maxSituations)
+    {
+        Q_ASSERT_X(maxSituations > 0 && maxSituations <= Capacity, Q_FUNC_INFO, "Wrong max.situations");
+        while (m_size >= maxSituations) { this->removeOldest(); }
+
+        Sample s;
+        const CAltitude &altitude = situation.getAltitude();
+        const CAltitude &elevation = situation.getGroundElevation();
+        const CSpeed &gs = situation.getGroundSpeed();
+        s.hasAltitude = !altitude.isNull();
+        s.hasElevation = !elevation.isNull();
+        s.hasGroundSpeed = !gs.isNull();
+        if (s.hasAltitude) { s.altitude = altitude.value(CAltitude::defaultUnit()); }
+        if (s.hasElevation) { s.elevation = elevation.value(CAltitude::defaultUnit()); }
+        if (s.hasGroundSpeed) { s.groundSpeed = gs.value(CSpeedUnit::kts()); }
+        s.pitch = situation.getPitch().value(CAngleUnit::deg());
+        s.nullPositionOrHeight = situation.isNull() || situation.isGeodeticHeightNull();
+        s.pushBack = gs.isNegativeWithEpsilonConsidered();
+
+        // compare with the current latest situation, same calculation as in CAircraftSituationList
+        if (m_size > 0)
+        {
+            const Sample &older = this->sample(0);
+            if (s.hasAltitude && older.hasAltitude)
+            {
+                const CLength delta = altitude - CLength(older.altitude, CAltitude::defaultUnit());
+                s.ascending  = delta.isPositiveWithEpsilonConsidered();
+                s.descending = delta.isNegativeWithEpsilonConsidered();
+            }
+            if (s.hasGroundSpeed && older.hasGroundSpeed)
+            {
+                const CSpeed delta = gs - CSpeed(older.groundSpeed, CSpeedUnit::kts());
+                s.accelerating = delta.isPositiveWithEpsilonConsidered();
+                s.decelerating = delta.isNegativeWithEpsilonConsidered();
+            }
+            else if (!s.hasGroundSpeed)
+            {
+                // a NULL newer ground speed is skipped in the list based comparison
+                s.accelerating = true;
+                s.decelerating = true;
+            }
+        }
+
+        m_front = (m_front + Capacity - 1) % Capacity;
+        m_size++;
+        this->sample(0) = s;
+        this->addValues(s);
+        if (m_size > 1) { this->addComparison(s); }
+
+        if (++m_additions >= RecalculateAfter) { this->recalculate(); }
+    }
+
+    void CAircraftSituationRunningStatistics::rebuild(const CAircraftSituationList &situationsLatestFirst)
+    {
+        this->clear();
+        const int n = qMin(situationsLatestFirst.size(), Capacity);
+        for (int i = n - 1; i >= 0; --i)
+        {
+            this->addLatest(situationsLatestFirst[i]);
+        }
+        m_valid = true;
+    }
+
+    CAltitudePair CAircraftSituationRunningStatistics::altitudeStandardDeviationAndMean() const
+    {
+        if (m_size < 1 || m_altitude.n != m_size) { return CAltitudePair(CAltitude::null(), CAltitude::null()); }
+        return CAltitudePair(CAltitude(m_altitude.standardDeviation(), CAltitude::MeanSeaLevel, CAltitude::defaultUnit()), CAltitude(m_altitude.mean, CAltitude::MeanSeaLevel, CAltitude::defaultUnit()));
+    }
+
+    CAltitudePair CAircraftSituationRunningStatistics::elevationStandardDeviationAndMean() const
+    {
+        if (m_size < 1 || m_elevation.n != m_size) { return CAltitudePair(CAltitude::null(), CAltitude::null()); }
+        return CAltitudePair(CAltitude(m_elevation.standardDeviation(), CAltitude::MeanSeaLevel, CAltitude::defaultUnit()), CAltitude(m_elevation.mean, CAltitude::MeanSeaLevel, CAltitude::defaultUnit()));
+    }
+
+    CSpeedPair CAircraftSituationRunningStatistics::groundSpeedStandardDeviationAndMean() const
+    {
+        if (m_size < 1 || m_groundSpeed.n != m_size) { return CSpeedPair(CSpeed::null(), CSpeed::null()); }
+        return CSpeedPair(CSpeed(m_groundSpeed.standardDeviation(), CSpeedUnit::kts()), CSpeed(m_groundSpeed.mean, CSpeedUnit::kts()));
+    }
+
+    CAnglePair CAircraftSituationRunningStatistics::pitchStandardDeviationAndMean() const
+    {
+        if (m_size < 1) { return CAnglePair(CAngle::null(), CAngle::null()); }
+        return CAnglePair(CAngle(m_pitch.standardDeviation(), CAngleUnit::deg()), CAngle(m_pitch.mean, CAngleUnit::deg()));
+    }
+
+    CLengthPair CAircraftSituationRunningStatistics::groundDistanceStandardDeviationAndMean() const
+    {
+        if (m_size < 1 || m_groundDistance.n != m_size) { return CLengthPair(CLength::null(), CLength::null()); }
+        return CLengthPair(CLength(m_groundDistance.standardDeviation(), CAltitude::defaultUnit()), CLength(m_groundDistance.mean, CAltitude::defaultUnit()));
+    }
+
+    CLengthPair CAircraftSituationRunningStatistics::minMaxGroundDistance() const
+    {
+        if (m_size < 1 || m_groundDistance.n != m_size) { return CLengthPair(CLength::null(), CLength::null()); }
+        double min = std::numeric_limits<double>::max();
+        double max = std::numeric_limits<double>::lowest();
+        for (int i = 0; i < m_size; ++i)
+        {
+            const double d = this->sample(i).groundDistance();
+            if (d < min) { min = d; }
+            if (d > max) { max = d; }
+        }
+        return CLengthPair(CLength(min, CAltitude::defaultUnit()), CLength(max, CAltitude::defaultUnit()));
+    }
+
+    bool CAircraftSituationRunningStatistics::isConstAscending() const
+    {
+        return m_size >= 2 && m_nullPositions == 0 && m_ascending == m_size - 1;
+    }
+
+    bool CAircraftSituationRunningStatistics::isConstDescending() const
+    {
+        return m_size >= 2 && m_nullPositions == 0 && m_descending == m_size - 1;
+    }
+
+    bool CAircraftSituationRunningStatistics::isConstAccelerating() const
+    {
+        return m_size >= 2 && m_nullPositions == 0 && m_accelerating == m_size - 1;
+    }
+
+    bool CAircraftSituationRunningStatistics::isConstDecelerating() const
+    {
+        return m_size >= 2 && m_nullPositions == 0 && m_decelerating == m_size - 1;
+    }
+
+    void CAircraftSituationRunningStatistics::addValues(const Sample &s)
+    {
+        if (s.hasAltitude) { m_altitude.add(s.altitude); }
+        if (s.hasElevation) { m_elevation.add(s.elevation); }
+        if (s.hasGroundSpeed) { m_groundSpeed.add(s.groundSpeed); }
+        if (s.hasGroundDistance()) { m_groundDistance.add(s.groundDistance()); }
+        m_pitch.add(s.pitch);
+        if (s.nullPositionOrHeight) { m_nullPositions++; }
+        if (s.pushBack) { m_pushBacks++; }
+    }
+
+    void CAircraftSituationRunningStatistics::removeValues(const Sample &s)
+    {
+        if (s.hasAltitude) { m_altitude.remove(s.altitude); }
+        if (s.hasElevation) { m_elevation.remove(s.elevation); }
+        if (s.hasGroundSpeed) { m_groundSpeed.remove(s.groundSpeed); }
+        if (s.hasGroundDistance()) { m_groundDistance.remove(s.groundDistance()); }
+        m_pitch.remove(s.pitch);
+        if (s.nullPositionOrHeight) { m_nullPositions--; }
+        if (s.pushBack) { m_pushBacks--; }
+    }
+
+    void CAircraftSituationRunningStatistics::addComparison(const Sample &s)
+    {
+        if (s.ascending) { m_ascending++; }
+        if (s.descending) { m_descending++; }
+        if (s.accelerating) { m_accelerating++; }
+        if (s.decelerating) { m_decelerating++; }
+    }
+
+    void CAircraftSituationRunningStatistics::removeComparison(const Sample &s)
+    {
+        if (s.ascending) { m_ascending--; }
+        if (s.descending) { m_descending--; }
+        if (s.accelerating) { m_accelerating--; }
+        if (s.decelerating) { m_decelerating--; }
+    }
+
+    void CAircraftSituationRunningStatistics::removeOldest()
+    {
+        if (m_size < 1) { return; }
+        const Sample &oldest = this->sample(m_size - 1);
+        this->removeValues(oldest);
+        if (m_size > 1)
+        {
+            // the second oldest one is no longer compared with anything
+            Sample &newOldest = this->sample(m_size - 2);
+            this->removeComparison(newOldest);
+            newOldest.ascending = newOldest.descending = newOldest.accelerating = newOldest.decelerating = false;
+        }
+        m_size--;
+    }
+
+    void CAircraftSituationRunningStatistics::recalculate()
+    {
+        m_altitude = RunningValue();
+        m_elevation = RunningValue();
+        m_groundSpeed = RunningValue();
+        m_pitch = RunningValue();
+        m_groundDistance = RunningValue();
+        m_nullPositions = 0;
+        m_pushBacks = 0;
+        for (int i = m_size - 1; i >= 0; --i) { this->addValues(this->sample(i)); }
+        m_additions = 0;
+    }
+
+    void CAircraftSituationRunningStatistics::clear()
+    {
+        m_front = 0;
+        m_size = 0;
+        m_ascending = m_descending = m_accelerating = m_decelerating = 0;
+        this->recalculate();
+        m_valid = false;
+    }
+} // ns
@@ -0,0 +1,185 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_AVIATION_AIRCRAFTSITUATIONRUNNINGSTATISTICS_H
+#define BLACKMISC_AVIATION_AIRCRAFTSITUATIONRUNNINGSTATISTICS_H
+
+#include "blackmisc/aviation/altitude.h"
+#include "blackmisc/pq/angle.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/speed.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <array>
+
+namespace BlackMisc::Aviation
+{
+    class CAircraftSituation;
+    class CAircraftSituationList;
+
+    //! Running statistics over the latest situations of one aircraft
+    //! \remark Values are added when a situation becomes the latest one and removed when the oldest one
+    //!         leaves the window, both in O(1). Provides what CAircraftSituationChange would otherwise
+    //!         calculate from the complete list.
+    //! \remark Sorted latest first, index 0 is the latest situation
+    class BLACKMISC_EXPORT CAircraftSituationRunningStatistics
+    {
+    public:
+        //! Max. number of situations
+        static constexpr int Capacity = 64;
+
+        //! Default constructor, invalid until built
+        CAircraftSituationRunningStatistics() = default;
+
+        //! Add the new latest situation, removes the oldest one if maxSituations are reached
+        void addLatest(const CAircraftSituation &situation, int maxSituations = Capacity);
+
+        //! Rebuild from situations sorted latest first
+        void rebuild(const CAircraftSituationList &situationsLatestFirst);
+
+        //! Values no longer correspond to the situations, e.g. elevations were changed
+        void invalidate() { m_valid = false; }
+
+        //! Built and still corresponding to the situations?
+        bool isValid() const { return m_valid; }
+
+        //! Number of situations
+        int size() const { return m_size; }
+
+        //! Altitude standard deviation and mean, null if not all situations have an altitude
+        CAltitudePair altitudeStandardDeviationAndMean() const;
+
+        //! Elevation standard deviation and mean, null if not all situations have an elevation
+        CAltitudePair elevationStandardDeviationAndMean() const;
+
+        //! Ground speed standard deviation and mean, null if not all situations have a ground speed
+        PhysicalQuantities::CSpeedPair groundSpeedStandardDeviationAndMean() const;
+
+        //! Pitch standard deviation and mean
+        PhysicalQuantities::CAnglePair pitchStandardDeviationAndMean() const;
+
+        //! Ground distance (altitude - elevation) standard deviation and mean, null if not available for all situations
+        PhysicalQuantities::CLengthPair groundDistanceStandardDeviationAndMean() const;
+
+        //! Min./max. ground distance, null if not available for all situations
+        //! \remark scans the compact values, not the situations
+        PhysicalQuantities::CLengthPair minMaxGroundDistance() const;
+
+        //! \copydoc BlackMisc::Aviation::CAircraftSituationList::isConstAscending
+        bool isConstAscending() const;
+
+        //! \copydoc BlackMisc::Aviation::CAircraftSituationList::isConstDescending
+        bool isConstDescending() const;
+
+        //! \copydoc BlackMisc::Aviation::CAircraftSituationList::isConstAccelerating
+        bool isConstAccelerating() const;
+
+        //! \copydoc BlackMisc::Aviation::CAircraftSituationList::isConstDecelarating
+        bool isConstDecelerating() const;
+
+        //! \copydoc BlackMisc::Aviation::CAircraftSituationList::containsPushBack
+        bool containsPushBack() const { return m_pushBacks > 0; }
+
+    private:
+        //! Mean and variance updated in O(1) (Welford)
+        struct RunningValue
+        {
+            int n = 0;
+            double mean = 0.0;
+            double m2 = 0.0; //!< sum of squared differences from the mean
+
+            //! Add value
+            void add(double value);
+
+            //! Remove a previously added value
+            void remove(double value);
+
+            //! Population standard deviation as CMathUtils::standardDeviationAndMean
+            double standardDeviation() const;
+        };
+
+        //! Values of one situation
+        struct Sample
+        {
+            double altitude = 0.0;   //!< CAltitude::defaultUnit
+            double elevation = 0.0;  //!< CAltitude::defaultUnit
+            double groundSpeed = 0.0; //!< kts
+            double pitch = 0.0;      //!< deg
+            bool hasAltitude = false;
+            bool hasElevation = false;
+            bool hasGroundSpeed = false;
+            bool nullPositionOrHeight = false;
+            bool pushBack = false;
+
+            //! Compared to the next older situation
+            //! @{
+            bool ascending = false;
+            bool descending = false;
+            bool accelerating = false;
+            bool decelerating = false;
+            //! @}
+
+            //! Ground distance
+            double groundDistance() const { return altitude - elevation; }
+
+            //! Ground distance available?
+            bool hasGroundDistance() const { return hasAltitude && hasElevation; }
+        };
+
+        //! Sample at index, 0 is the latest
+        //! @{
+        Sample &sample(int index) { return m_samples[static_cast<size_t>((m_front + index) % Capacity)]; }
+        const Sample &sample(int index) const { return m_samples[static_cast<size_t>((m_front + index) % Capacity)]; }
+        //! @}
+
+        //! Add/remove the values of a sample
+        //! @{
+        void addValues(const Sample &s);
+        void removeValues(const Sample &s);
+        //! @}
+
+        //! Add/remove the comparison of a sample with its next older one
+        //! @{
+        void addComparison(const Sample &s);
+        void removeComparison(const Sample &s);
+        //! @}
+
+        //! Remove the oldest situation
+        void removeOldest();
+
+        //! Recalculate the running values from the samples to avoid accumulating rounding errors
+        void recalculate();
+
+        //! Reset all values
+        void clear();
+
+        //! Recalculate after n additions
+        static constexpr int RecalculateAfter = 1024;
+
+        std::array<Sample, Capacity> m_samples;
+        int m_front = 0; //!< ring index of the latest situation
+        int m_size = 0;
+        int m_additions = 0; //!< additions since recalculation
+        bool m_valid = false;
+        RunningValue m_altitude;
+        RunningValue m_elevation;
+        RunningValue m_groundSpeed;
+        RunningValue m_pitch;
+        RunningValue m_groundDistance;
+        int m_nullPositions = 0;
+        int m_pushBacks = 0;
+        int m_ascending = 0;    //!< consecutive pairs
+        int m_descending = 0;   //!< consecutive pairs
+        int m_accelerating = 0; //!< consecutive pairs
+        int m_decelerating = 0; //!< consecutive pairs
+    };
+} // ns
+
+#endif // guard
@@ -414,31 +414,31 @@ namespace BlackMisc::Aviation
         if (otherCode.hasValidDesignator() && this->getDesignator() == otherCode.getDesignator())
         {
             score += 60;
-            addLogDetailsToList(log, *this, QStringLiteral("Same designator: %1").arg(score));
+            if (log) { addLogDetailsToList(log, *this, QStringLiteral("Same designator: %1").arg(score)); }
         }
 
         // only for DB values we check VA
         if (bothFromDb && this->isVirtualAirline() == otherCode.isVirtualAirline())
         {
             score += 20;
-            addLogDetailsToList(log, *this, QStringLiteral("VA equality: %1").arg(score));
+            if (log) { addLogDetailsToList(log, *this, QStringLiteral("VA equality: %1").arg(score)); }
         }
 
         // consider the various names
         if (this->hasName() && this->getName() == otherCode.getName())
         {
             score += 20;
-            addLogDetailsToList(log, *this, QStringLiteral("Same name '%1': %2").arg(this->getName()).arg(score));
+            if (log) { addLogDetailsToList(log, *this, QStringLiteral("Same name '%1': %2").arg(this->getName()).arg(score)); }
         }
         else if (this->hasTelephonyDesignator() && this->getTelephonyDesignator() == otherCode.getTelephonyDesignator())
         {
             score += 15;
-            addLogDetailsToList(log, *this, QStringLiteral("Same telephony '%1': %2").arg(this->getTelephonyDesignator()).arg(score));
+            if (log) { addLogDetailsToList(log, *this, QStringLiteral("Same telephony '%1': %2").arg(this->getTelephonyDesignator()).arg(score)); }
         }
         else if (this->hasSimplifiedName() && this->getSimplifiedName() == otherCode.getSimplifiedName())
         {
             score += 10;
-            addLogDetailsToList(log, *this, QStringLiteral("Same simplified name '%1': %2").arg(this->getSimplifiedName()).arg(score));
+            if (log) { addLogDetailsToList(log, *this, QStringLiteral("Same simplified name '%1': %2").arg(this->getSimplifiedName()).arg(score)); }
         }
         return score;
     }
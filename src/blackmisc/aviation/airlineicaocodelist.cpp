@@ -10,9 +10,11 @@
 #include "blackmisc/logcategories.h"
 #include "blackmisc/country.h"
 #include "blackmisc/setbuilder.h"
+#include "blackmisc/threadutils.h"
 
 #include <QJsonValue>
 #include <QStringBuilder>
+#include <vector>
 
 BLACK_DEFINE_SEQUENCE_MIXINS(BlackMisc::Aviation, CAirlineIcaoCode, CAirlineIcaoCodeList)
 
@@ -284,23 +286,39 @@ namespace BlackMisc::Aviation
         return airlineCode;
     }
 
-    CAirlineIcaoCodeList CAirlineIcaoCodeList::fromDatabaseJson(const QJsonArray &array,  bool ignoreIncomplete, CAirlineIcaoCodeList *inconsistent)
+    CAirlineIcaoCodeList CAirlineIcaoCodeList::fromDatabaseJson(const QJsonArray &array,  bool ignoreIncomplete, CAirlineIcaoCodeList *inconsistent, const std::function<void(int)> &progress)
     {
-        CAirlineIcaoCodeList codes;
-        for (const QJsonValue &value : array)
-        {
-            const CAirlineIcaoCode icao(CAirlineIcaoCode::fromDatabaseJson(value.toObject()));
-            const bool incomplete = !icao.hasCompleteData();
-            if (incomplete)
+        constexpr int MinCodesPerThread = 2048;
+        const int n = array.size();
+        const int chunks = parallelChunkCount(n, MinCodesPerThread);
+        std::vector<CAirlineIcaoCodeList> chunkCodes(static_cast<size_t>(chunks));
+        std::vector<CAirlineIcaoCodeList> chunkInconsistent(static_cast<size_t>(chunks));
+        forEachChunkParallel(n, chunks, [&](int c, int from, int to)
+        {
+            const QJsonArray chunkArray(array); // own copy, only reentrant
+            CAirlineIcaoCodeList &codes = chunkCodes[static_cast<size_t>(c)];
+            for (int i = from; i < to; ++i)
             {
-                if (ignoreIncomplete) { continue; }
-                if (inconsistent)
+                const CAirlineIcaoCode icao(CAirlineIcaoCode::fromDatabaseJson(chunkArray.at(i).toObject()));
+                const bool incomplete = !icao.hasCompleteData();
+                if (incomplete)
                 {
-                    inconsistent->push_back(icao);
-                    continue;
+                    if (ignoreIncomplete) { continue; }
+                    if (inconsistent)
+                    {
+                        chunkInconsistent[static_cast<size_t>(c)].push_back(icao);
+                        continue;
+                    }
                 }
+                codes.push_back(icao);
             }
-            codes.push_back(icao);
+        }, progress);
+
+        CAirlineIcaoCodeList codes;
+        for (int c = 0; c < chunks; ++c)
+        {
+            codes.push_back(std::move(chunkCodes[static_cast<size_t>(c)]));
+            if (inconsistent) { inconsistent->push_back(std::move(chunkInconsistent[static_cast<size_t>(c)])); }
         }
         return codes;
     }
@@ -22,6 +22,7 @@
 #include <QMetaType>
 #include <QString>
 #include <QStringList>
+#include <functional>
 #include <tuple>
 
 BLACK_DECLARE_SEQUENCE_MIXINS(BlackMisc::Aviation, CAirlineIcaoCode, CAirlineIcaoCodeList)
@@ -134,7 +135,8 @@ namespace BlackMisc::Aviation
         AirlineIcaoIdMap toIdMap() const;
 
         //! From our DB JSON
-        static CAirlineIcaoCodeList fromDatabaseJson(const QJsonArray &array, bool ignoreIncomplete = true, CAirlineIcaoCodeList *inconsistent = nullptr);
+        //! \remark large arrays are converted in parallel chunks, progress is called with the number of converted codes
+        static CAirlineIcaoCodeList fromDatabaseJson(const QJsonArray &array, bool ignoreIncomplete = true, CAirlineIcaoCodeList *inconsistent = nullptr, const std::function<void(int)> &progress = {});
     };
 } // namespace
 
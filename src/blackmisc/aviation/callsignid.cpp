@@ -0,0 +1,111 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/aviation/callsignid.h"
+
+#include <QHash>
+#include <QReadWriteLock>
+#include <QString>
+#include <QThreadStorage>
+#include <QtGlobal>
+#include <atomic>
+#include <memory>
+
+namespace BlackMisc::Aviation
+{
+    namespace
+    {
+        //! \private Process-wide intern table
+        //! \remark interned callsigns are kept in blocks which are never moved or released,
+        //!          so an identifier can be mapped back to its callsign without a lock
+        struct CallsignInternTable
+        {
+            static constexpr quint32 BlockSize = 256;
+            static constexpr quint32 MaxBlocks = 4096; // about one million callsigns per process
+
+            QReadWriteLock lock;
+            QHash<QString, quint32> ids;                      //!< unified callsign string -> id, guarded by lock
+            std::unique_ptr<CCallsign[]> blocks[MaxBlocks];   //!< callsign of id, index id - 1, written under lock
+            std::atomic<CCallsign *> published[MaxBlocks] {}; //!< blocks readable without lock
+            std::atomic<quint32> count { 0 };
+        };
+
+        CallsignInternTable &internTable()
+        {
+            static CallsignInternTable table;
+            return table;
+        }
+
+        //! \private Key of callsign, callsigns compare case insensitive
+        QString internKey(const CCallsign &callsign)
+        {
+            const QString &cs = callsign.asString();
+            return cs.isUpper() ? cs : cs.toUpper();
+        }
+
+        //! \private Identifiers already looked up by this thread, avoids the table lock for known callsigns
+        QHash<QString, quint32> &threadIds()
+        {
+            static QThreadStorage<QHash<QString, quint32>> ids;
+            return ids.localData();
+        }
+    }
+
+    CCallsignId::CCallsignId(const CCallsign &callsign)
+    {
+        if (callsign.asString().isEmpty()) { return; } // equal to the default callsign
+        const QString key = internKey(callsign);
+        QHash<QString, quint32> &known = threadIds();
+        const auto knownIt = known.constFind(key);
+        if (knownIt != known.constEnd()) { m_id = knownIt.value(); return; }
+
+        CallsignInternTable &table = internTable();
+        {
+            QReadLocker l(&table.lock);
+            const auto it = table.ids.constFind(key);
+            if (it != table.ids.constEnd()) { m_id = it.value(); }
+        }
+
+        if (m_id == 0)
+        {
+            QWriteLocker l(&table.lock);
+            const auto it = table.ids.constFind(key); // interned meanwhile?
+            if (it != table.ids.constEnd()) { m_id = it.value(); }
+            else
+            {
+                const quint32 index = table.count.load(std::memory_order_relaxed);
+                const quint32 block = index / CallsignInternTable::BlockSize;
+                Q_ASSERT_X(block < CallsignInternTable::MaxBlocks, Q_FUNC_INFO, "Too many callsigns");
+                if (!table.blocks[block])
+                {
+                    table.blocks[block].reset(new CCallsign[CallsignInternTable::BlockSize]);
+                    table.published[block].store(table.blocks[block].get(), std::memory_order_release);
+                }
+                table.blocks[block][index % CallsignInternTable::BlockSize] = callsign;
+                table.count.store(index + 1, std::memory_order_release);
+                m_id = index + 1;
+                table.ids.insert(key, m_id);
+            }
+        }
+        known.insert(key, m_id);
+    }
+
+    CCallsign CCallsignId::toCallsign() const
+    {
+        if (m_id == 0) { return {}; }
+        // the identifier was created after its callsign was stored
+        const quint32 index = m_id - 1;
+        const CCallsign *block = internTable().published[index / CallsignInternTable::BlockSize].load(std::memory_order_acquire);
+        return block ? block[index % CallsignInternTable::BlockSize] : CCallsign();
+    }
+
+    int CCallsignId::internedCount()
+    {
+        return static_cast<int>(internTable().count.load(std::memory_order_acquire));
+    }
+} // ns
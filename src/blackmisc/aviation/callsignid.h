@@ -0,0 +1,72 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_AVIATION_CALLSIGNID_H
+#define BLACKMISC_AVIATION_CALLSIGNID_H
+
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QHash>
+#include <QtGlobal>
+
+namespace BlackMisc::Aviation
+{
+    /*!
+     * Process-wide identifier of an interned callsign, for per callsign containers in the hot path.
+     *
+     * Equal callsigns get the same identifier, so hashing and comparing is an integer operation.
+     * Creating an identifier hashes the callsign string, so it should be created where a callsign enters
+     * the hot path and then be kept, like the interpolators do. Known callsigns are looked up without the
+     * process-wide lock, and toCallsign is lock free. Identifiers are never released and are not valid
+     * in other processes, so they must not be persisted or transferred.
+     * \threadsafe
+     */
+    class BLACKMISC_EXPORT CCallsignId
+    {
+    public:
+        //! Default constructor, empty callsign
+        CCallsignId() = default;
+
+        //! Identifier of callsign, interned if not yet known
+        //! \remark empty callsigns have the empty identifier
+        explicit CCallsignId(const CCallsign &callsign);
+
+        //! The interned callsign
+        //! \remark the first callsign interned for this identifier, equal to all callsigns with this identifier
+        CCallsign toCallsign() const;
+
+        //! Empty callsign?
+        bool isEmpty() const { return m_id == 0; }
+
+        //! Integer value
+        quint32 value() const { return m_id; }
+
+        //! Number of interned callsigns
+        static int internedCount();
+
+        //! Compare
+        //! @{
+        friend bool operator ==(CCallsignId a, CCallsignId b) { return a.m_id == b.m_id; }
+        friend bool operator !=(CCallsignId a, CCallsignId b) { return a.m_id != b.m_id; }
+        friend bool operator <(CCallsignId a, CCallsignId b) { return a.m_id < b.m_id; }
+        //! @}
+
+        //! Hash
+        friend uint qHash(CCallsignId id, uint seed = 0) { return ::qHash(id.m_id, seed); }
+
+    private:
+        quint32 m_id = 0; //!< 0 is the empty callsign
+    };
+} // namespace
+
+Q_DECLARE_TYPEINFO(BlackMisc::Aviation::CCallsignId, Q_PRIMITIVE_TYPE);
+
+#endif // guard
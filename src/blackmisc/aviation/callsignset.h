@@ -21,6 +21,17 @@
 #include <QStringList>
 #include <tuple>
 
+namespace BlackMisc
+{
+    //! Callsign sets are mostly used for membership tests, so they are stored in a sorted vector
+    template <>
+    struct TCollectionStorage<Aviation::CCallsign>
+    {
+        //! Storage type
+        using type = QFlatOrderedSet<Aviation::CCallsign>;
+    };
+}
+
 BLACK_DECLARE_COLLECTION_MIXINS(BlackMisc::Aviation, CCallsign, CCallsignSet)
 
 namespace BlackMisc::Aviation
@@ -467,7 +467,7 @@ namespace BlackMisc::Aviation
             // 2 color liveries 25..85
             score = 25;
             score += 60 * colorMultiplier;
-            addLogDetailsToList(log, *this, QStringLiteral("2 color liveries, color multiplier %1: %2").arg(colorMultiplier).arg(score));
+            if (log) { addLogDetailsToList(log, *this, QStringLiteral("2 color liveries, color multiplier %1: %2").arg(colorMultiplier).arg(score)); }
         }
         else if (this->isAirlineLivery() && otherLivery.isAirlineLivery())
         {
@@ -478,10 +478,10 @@ namespace BlackMisc::Aviation
             // same ICAO at least means 30, max 50
             score = qRound(0.5 * this->getAirlineIcaoCode().calculateScore(otherLivery.getAirlineIcaoCode(), log));
             score += 25 * colorMultiplier;
-            addLogDetailsToList(log, *this, QStringLiteral("2 airline liveries, color multiplier %1: %2").arg(colorMultiplier).arg(score));
+            if (log) { addLogDetailsToList(log, *this, QStringLiteral("2 airline liveries, color multiplier %1: %2").arg(colorMultiplier).arg(score)); }
             if (this->isMilitary() == otherLivery.isMilitary())
             {
-                addLogDetailsToList(log, *this, QStringLiteral("Mil.flag '%1' matches: %2").arg(boolToYesNo(this->isMilitary())).arg(score));
+                if (log) { addLogDetailsToList(log, *this, QStringLiteral("Mil.flag '%1' matches: %2").arg(boolToYesNo(this->isMilitary())).arg(score)); }
                 score += 10;
             }
         }
@@ -492,7 +492,7 @@ namespace BlackMisc::Aviation
             // 25 is weaker as same ICAO code / 2 from above
             score = preferColorLiveries ? 25 : 0;
             score += 25 * colorMultiplier; // needs to be the same as in 2 airlines
-            addLogDetailsToList(log, *this, QStringLiteral("Color/airline mixed, color multiplier %1: %2").arg(colorMultiplier).arg(score));
+            if (log) { addLogDetailsToList(log, *this, QStringLiteral("Color/airline mixed, color multiplier %1: %2").arg(colorMultiplier).arg(score)); }
         }
         return score;
     }
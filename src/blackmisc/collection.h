@@ -14,7 +14,9 @@
 #include "blackmisc/containerbase.h"
 #include "blackmisc/mixin/mixindatastream.h"
 #include "blackmisc/mixin/mixinicon.h"
+#include <QDataStream>
 #include <QMap>
+#include <QVector>
 #include <algorithm>
 #include <type_traits>
 #include <typeindex>
@@ -86,6 +88,156 @@ namespace BlackMisc
 
         //! Constructor from QList
         QOrderedSet(const QList<T> &list) { for (const auto &v : list) { insert(v); }}
+
+        //! Remove the element at the given position.
+        //! \fixme Relying on implementation detail of QMap to reinterpret_cast to the necessary iterator type.
+        typename QMap<T, T>::const_iterator erase(typename QMap<T, T>::const_iterator pos)
+        {
+            return QMap<T, T>::erase(const_cast<QMapNode<T, T> *&>(reinterpret_cast<const QMapNode<T, T> *&>(pos)));
+        }
+    };
+
+    /*!
+     * Ordered set stored in a sorted QVector, alternative storage of CCollection.
+     *
+     * Each element is stored once in contiguous memory instead of as key and value of a tree node,
+     * lookups are binary searches. Iterates in the same order as QOrderedSet and uses the same data stream format.
+     * Inserting in order (e.g. from set algorithms) appends, inserting elsewhere is O(n).
+     */
+    template <class T>
+    class QFlatOrderedSet
+    {
+    public:
+        //! Type of values stored in the set.
+        using value_type = T;
+
+        //! Iterators, elements can't be modified in-place
+        //! @{
+        using const_iterator = typename QVector<T>::const_iterator;
+        using iterator = const_iterator;
+        //! @}
+
+        //! Default constructor.
+        QFlatOrderedSet() {}
+
+        //! Initializer list constructor.
+        QFlatOrderedSet(std::initializer_list<T> il) : m_elements(il) { sortAndRemoveDuplicates(); }
+
+        //! Constructor from QList
+        QFlatOrderedSet(const QList<T> &list) : m_elements(list.toVector()) { sortAndRemoveDuplicates(); }
+
+        //! Iterators
+        //! @{
+        const_iterator begin() const { return m_elements.cbegin(); }
+        const_iterator cbegin() const { return m_elements.cbegin(); }
+        const_iterator end() const { return m_elements.cend(); }
+        const_iterator cend() const { return m_elements.cend(); }
+        //! @}
+
+        //! Number of elements
+        int size() const { return m_elements.size(); }
+
+        //! Empty?
+        bool isEmpty() const { return m_elements.isEmpty(); }
+
+        //! Remove all elements
+        void clear() { m_elements.clear(); }
+
+        //! Swap with another set
+        void swap(QFlatOrderedSet &other) noexcept { m_elements.swap(other.m_elements); }
+
+        //! Insert a value, an equal element is replaced like in QOrderedSet.
+        const_iterator insert(const T &value)
+        {
+            if (m_elements.isEmpty() || m_elements.constLast() < value)
+            {
+                m_elements.push_back(value);
+                return std::prev(m_elements.cend());
+            }
+            const auto it = std::lower_bound(m_elements.begin(), m_elements.end(), value);
+            if (value < *it) { return m_elements.insert(it, value); }
+            *it = value;
+            return it;
+        }
+
+        //! Find element by binary search
+        const_iterator find(const T &value) const
+        {
+            const auto it = std::lower_bound(m_elements.cbegin(), m_elements.cend(), value);
+            return (it == m_elements.cend() || value < *it) ? m_elements.cend() : it;
+        }
+
+        //! Remove the element at the given position.
+        const_iterator erase(const_iterator pos)
+        {
+            const int index = static_cast<int>(pos - m_elements.cbegin()); // before detaching
+            return m_elements.erase(m_elements.begin() + index);
+        }
+
+        //! Detach from shared data
+        void detach() { m_elements.detach(); }
+
+        //! Equal
+        friend bool operator ==(const QFlatOrderedSet &a, const QFlatOrderedSet &b) { return a.m_elements == b.m_elements; }
+
+        //! Not equal
+        friend bool operator !=(const QFlatOrderedSet &a, const QFlatOrderedSet &b) { return a.m_elements != b.m_elements; }
+
+        //! Write to data stream, same format as QMap<T, T>
+        friend QDataStream &operator <<(QDataStream &stream, const QFlatOrderedSet &set)
+        {
+            stream << quint32(set.size());
+            for (auto it = set.m_elements.crbegin(); it != set.m_elements.crend(); ++it) { stream << *it << *it; }
+            return stream;
+        }
+
+        //! Read from data stream, same format as QMap<T, T>
+        friend QDataStream &operator >>(QDataStream &stream, QFlatOrderedSet &set)
+        {
+            quint32 n = 0;
+            stream >> n;
+            set.m_elements.clear();
+            set.m_elements.reserve(static_cast<int>(n));
+            for (quint32 i = 0; i < n && stream.status() == QDataStream::Ok; ++i)
+            {
+                T key;
+                T value;
+                stream >> key >> value;
+                set.m_elements.push_back(value);
+            }
+            set.sortAndRemoveDuplicates();
+            return stream;
+        }
+
+    private:
+        //! Sort, the last of equal elements is kept like in QOrderedSet
+        void sortAndRemoveDuplicates()
+        {
+            std::stable_sort(m_elements.begin(), m_elements.end());
+            auto out = m_elements.begin();
+            for (auto it = m_elements.begin(); it != m_elements.end(); ++it)
+            {
+                const auto next = std::next(it);
+                if (next != m_elements.end() && !(*it < *next)) { continue; } // a later equal element follows
+                if (out != it) { *out = std::move(*it); }
+                ++out;
+            }
+            m_elements.erase(out, m_elements.end());
+        }
+
+        QVector<T> m_elements; //!< sorted, no equal elements
+    };
+
+    /*!
+     * Storage of CCollection<T>.
+     * Specialize with QFlatOrderedSet for element types whose collections are mostly used for membership tests,
+     * the specialization must be visible wherever CCollection<T> is used (i.e. next to the set class).
+     */
+    template <class T>
+    struct TCollectionStorage
+    {
+        //! Storage type
+        using type = QOrderedSet<T>;
     };
 
     /*!
@@ -107,7 +259,7 @@ namespace BlackMisc
         typedef const T &const_reference;
         typedef T *pointer;
         typedef const T *const_pointer;
-        typedef typename QOrderedSet<T>::const_iterator const_iterator;
+        typedef typename TCollectionStorage<T>::type::const_iterator const_iterator;
         typedef const_iterator iterator; // can't modify elements in-place
         typedef ptrdiff_t difference_type;
         typedef int size_type;
@@ -246,15 +398,10 @@ namespace BlackMisc
 
         //! Remove the element pointed to by the given iterator.
         //! \return An iterator to the position of the next element after the one removed.
-        //! \fixme Relying on implementation detail of QMap to reinterpret_cast to the necessary iterator type.
-        iterator erase(iterator pos)
-        {
-            return m_impl.erase(const_cast<QMapNode<T, T> *&>(reinterpret_cast<const QMapNode<T, T> *&>(pos)));
-        }
+        iterator erase(iterator pos) { return m_impl.erase(pos); }
 
         //! Remove the range of elements between two iterators.
         //! \return An iterator to the position of the next element after the one removed.
-        //! \fixme Relying on implementation detail of QMap to reinterpret_cast to the necessary iterator type.
         iterator erase(iterator it1, iterator it2)
         {
             while (it1 != it2) { it1 = erase(it1); }
@@ -306,7 +453,7 @@ namespace BlackMisc
             return this->to(QList<T>());
         }
 
-        //! \private Calls detach on the internal QMap.
+        //! \private Calls detach on the internal storage.
         void detach() { m_impl.detach(); }
 
         //! Test for equality.
@@ -322,7 +469,7 @@ namespace BlackMisc
         void unmarshalFromDataStream(QDataStream &stream) { stream >> m_impl; }
 
     private:
-        QOrderedSet<T> m_impl;
+        typename TCollectionStorage<T>::type m_impl;
     };
 
 } //namespace BlackMisc
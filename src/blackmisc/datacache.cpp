@@ -120,7 +120,14 @@ namespace BlackMisc
 
     QString CDataCache::filenameForKey(const QString &key)
     {
-        return CFileUtils::appendFilePaths(persistentStore(), instance()->CValueCache::filenameForKey(key));
+        const QString filename = CFileUtils::appendFilePaths(persistentStore(), instance()->CValueCache::filenameForKey(key));
+        if (filename.endsWith(".bin") && !QFile::exists(filename))
+        {
+            // binary value still in its Json file, migrated when loaded
+            const QString jsonFilename = filename.chopped(4) + ".json";
+            if (QFile::exists(jsonFilename)) { return jsonFilename; }
+        }
+        return filename;
     }
 
     QStringList CDataCache::enumerateStore() const
@@ -189,6 +196,11 @@ namespace BlackMisc
         singleShot(0, m_serializer, [this, key] { m_revision.sessionValue(key); });
     }
 
+    void CDataCache::binaryValue(const QString &key, const BinaryFormat &format)
+    {
+        setBinaryFormat(key, format);
+    }
+
     const QString &CDataCache::relativeFilePath()
     {
         static const QString p("/data/cache/core");
@@ -313,6 +325,15 @@ namespace BlackMisc
 
             msg.setCategories(this);
             CLogMessage::preformatted(msg);
+
+            // one time migration of values loaded from Json files, which are now saved in binary files
+            const CVariantMap migrate = m_cache->getValuesToMigrateToBinary(persistentStore(), newValues.toVariantMap());
+            if (! migrate.isEmpty())
+            {
+                auto migrateMsg = m_cache->saveToFiles(persistentStore(), migrate);
+                migrateMsg.setCategories(this);
+                CLogMessage::preformatted(migrateMsg);
+            }
             m_deferredChanges.insert(newValues);
         }
 
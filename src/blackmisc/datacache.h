@@ -291,6 +291,9 @@ namespace BlackMisc
         //! Method used for implementing session values.
         void sessionValue(const QString &key);
 
+        //! Method used for implementing binary values.
+        void binaryValue(const QString &key, const BinaryFormat &format);
+
         //! Relative file path in application data directory
         static const QString &relativeFilePath();
 
@@ -332,6 +335,7 @@ namespace BlackMisc
             if (Trait::isPinned())   { CDataCache::instance()->pinValue(this->getKey()); }
             if (Trait::isDeferred()) { CDataCache::instance()->deferValue(this->getKey()); }
             if (Trait::isSession())  { CDataCache::instance()->sessionValue(this->getKey()); }
+            if (Trait::isBinary())   { CDataCache::instance()->binaryValue(this->getKey(), binaryFormat()); }
             static_assert(!(Trait::isPinned() && Trait::isDeferred()), "trait can not be both pinned and deferred");
         }
 
@@ -413,6 +417,17 @@ namespace BlackMisc
 
         //! Data cache doesn't support save (because currently set value is saved already).
         CStatusMessage save() = delete;
+
+    private:
+        //! Binary format of the trait
+        static CValueCache::BinaryFormat binaryFormat()
+        {
+            return
+            {
+                [](const CVariant &value) { return Trait::toBinary(value.to<typename Trait::type>()); },
+                [](const QByteArray &data, CStatusMessage &o_status) { return CVariant::from(Trait::fromBinary(data, o_status)); }
+            };
+        }
     };
 
     /*!
@@ -475,6 +490,16 @@ namespace BlackMisc
         //! is retained only while there are applications using the cache.
         static constexpr bool isSession() { return false; }
 
+        //! If true, then value will be saved in a binary file instead of a Json file, using toBinary and fromBinary.
+        //! Good for large values which are slow to parse from Json; the whole value is still converted when loaded.
+        static constexpr bool isBinary() { return false; }
+
+        //! Binary data of the value, only used if isBinary. Reimplemented in derived class.
+        static QByteArray toBinary(const T &value) { Q_UNUSED(value); qFatal("Not implemented"); return {}; }
+
+        //! Value of binary data written by toBinary, only used if isBinary. Reimplemented in derived class.
+        static T fromBinary(const QByteArray &data, CStatusMessage &o_status) { Q_UNUSED(data); Q_UNUSED(o_status); qFatal("Not implemented"); return {}; }
+
         //! Deleted default constructor.
         TDataTrait() = delete;
 
@@ -16,10 +16,16 @@
 #include "blackmisc/db/datastore.h"
 #include "blackmisc/setbuilder.h"
 #include "blackmisc/mapbuilder.h"
+#include "blackmisc/threadutils.h"
+#include <QHash>
 #include <QJsonArray>
 #include <QSet>
+#include <QVector>
 #include <QMap>
 #include <QString>
+#include <functional>
+#include <utility>
+#include <vector>
 
 namespace BlackMisc::Db
 {
@@ -189,32 +195,87 @@ namespace BlackMisc::Db
         {
             if (this->container().isEmpty()) { return 0; }
             CONTAINER newValues;
-            for (const OBJ &obj : ITimestampObjectList<OBJ, CONTAINER>::container())
+            for (const OBJ &obj : std::as_const(ITimestampObjectList<OBJ, CONTAINER>::container()))
             {
                 if (!obj.hasValidDbKey()) { continue; }
                 newValues.push_back(obj);
             }
-            int delta = this->container().size() - newValues.size();
+            const int delta = this->container().size() - newValues.size();
+            if (delta < 1) { return 0; } // keep the (shared) values
             this->container() = newValues;
             return delta;
         }
 
         //! Update or insert data (based on DB key)
-        int replaceOrAddObjectsByKey(const CONTAINER &container)
+        //! \remark objects are replaced in place, objects not yet contained are appended
+        //! \remark further objects with the key of a replaced object are removed, unchanged objects are not counted
+        //! \return number of updated and added objects
+        int replaceOrAddObjectsByKey(const CONTAINER &container, int *updated = nullptr, int *added = nullptr, int *removed = nullptr)
         {
+            if (updated) { *updated = 0; }
+            if (added)   { *added = 0; }
+            if (removed) { *removed = 0; }
             if (container.isEmpty()) { return 0; }
             if (this->container().isEmpty())
             {
                 this->container() = container;
+                if (added) { *added = container.size(); }
                 return this->container().size();
             }
-            CONTAINER newValues(this->container());
-            const QSet<KEYTYPE> keys(container.toDbKeySet());
-            newValues.removeObjectsWithKeys(keys);
-            int removeSize = newValues.size(); // size after removing data
-            newValues.push_back(container);
-            this->container() = newValues;
-            return newValues.size() - removeSize;
+
+            // index of the new objects by key, the list itself is only touched where objects change
+            QHash<KEYTYPE, int> newIndexes;
+            newIndexes.reserve(container.size());
+            for (int i = 0; i < container.size(); ++i)
+            {
+                const OBJ &obj = container[i];
+                if (obj.hasValidDbKey() && !newIndexes.contains(obj.getDbKey())) { newIndexes.insert(obj.getDbKey(), i); }
+            }
+
+            // replace in place, further objects with the same key are removed
+            QVector<bool> merged(container.size(), false);
+            QVector<int> duplicates;
+            int updatedObjects = 0;
+            for (int i = 0; i < this->container().size(); ++i)
+            {
+                const OBJ &obj = std::as_const(this->container())[i];
+                if (!obj.hasValidDbKey()) { continue; }
+                const auto it = newIndexes.constFind(obj.getDbKey());
+                if (it == newIndexes.cend()) { continue; }
+                if (merged[*it]) { duplicates.push_back(i); continue; }
+                merged[*it] = true;
+                const OBJ &newObj = container[*it];
+                if (obj == newObj) { continue; }
+                this->container()[i] = newObj;
+                updatedObjects++;
+            }
+
+            if (!duplicates.isEmpty())
+            {
+                int d = 0;
+                int to = 0;
+                for (int from = 0; from < this->container().size(); ++from)
+                {
+                    if (d < duplicates.size() && duplicates[d] == from) { d++; continue; }
+                    if (to != from) { this->container()[to] = std::move(this->container()[from]); }
+                    to++;
+                }
+                this->container().truncate(to);
+            }
+
+            // objects without key or with a key not yet contained
+            int addedObjects = 0;
+            for (int i = 0; i < container.size(); ++i)
+            {
+                if (merged[i]) { continue; }
+                this->container().push_back(container[i]);
+                addedObjects++;
+            }
+
+            if (updated) { *updated = updatedObjects; }
+            if (added)   { *added = addedObjects; }
+            if (removed) { *removed = duplicates.size(); }
+            return updatedObjects + addedObjects;
         }
 
         //! Latest DB timestamp (means objects with DB key)
@@ -337,13 +398,26 @@ namespace BlackMisc::Db
 
         //! From DB JSON with default prefixes
         //! \remark Specialized classes might have their own fromDatabaseJson implementation
-        static CONTAINER fromDatabaseJson(const QJsonArray &array)
+        //! \remark large arrays are converted in parallel chunks, progress is called with the number of converted objects
+        static CONTAINER fromDatabaseJson(const QJsonArray &array, const std::function<void(int)> &progress = {})
         {
-            CONTAINER container;
-            for (const QJsonValue &value : array)
+            constexpr int MinObjectsPerThread = 2048;
+            const int n = array.size();
+            const int chunks = parallelChunkCount(n, MinObjectsPerThread);
+            std::vector<CONTAINER> chunkContainers(static_cast<size_t>(chunks));
+            forEachChunkParallel(n, chunks, [&](int c, int from, int to)
             {
-                container.push_back(OBJ::fromDatabaseJson(value.toObject()));
-            }
+                const QJsonArray chunkArray(array); // own copy, only reentrant
+                CONTAINER &container = chunkContainers[static_cast<size_t>(c)];
+                for (int i = from; i < to; ++i)
+                {
+                    container.push_back(OBJ::fromDatabaseJson(chunkArray.at(i).toObject()));
+                }
+            }, progress);
+
+            if (chunkContainers.size() == 1) { return std::move(chunkContainers.front()); }
+            CONTAINER container;
+            for (CONTAINER &chunk : chunkContainers) { container.push_back(std::move(chunk)); }
             return container;
         }
 
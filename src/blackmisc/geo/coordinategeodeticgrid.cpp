@@ -0,0 +1,327 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/geo/coordinategeodeticgrid.h"
+#include "blackmisc/pq/units.h"
+
+#include <QDateTime>
+#include <QSet>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Geo
+{
+    namespace
+    {
+        //! Meters per degree latitude, same earth radius as calculateGreatCircleDistance
+        constexpr double MetersPerDegree = 6371000.8 * M_PI / 180.0;
+
+        //! Max. great circle distance
+        constexpr double HalfCircumferenceMeters = 180.0 * MetersPerDegree;
+
+        //! Margin for the float precision of calculateGreatCircleDistance
+        constexpr double MarginMeters = 10.0;
+    }
+
+    CCoordinateGeodeticGrid::CCoordinateGeodeticGrid(double cellDegrees) :
+        m_cellDegrees(qBound(0.0001, cellDegrees, 90.0))
+    {
+        m_lonCells = static_cast<int>(std::ceil(360.0 / m_cellDegrees));
+    }
+
+    void CCoordinateGeodeticGrid::clear()
+    {
+        m_cells.clear();
+        m_order.clear();
+    }
+
+    void CCoordinateGeodeticGrid::insert(const ICoordinateGeodetic &coordinate, qint64 timestampMsSinceEpoch)
+    {
+        if (coordinate.isNull()) { return; }
+        if (timestampMsSinceEpoch < 0) { timestampMsSinceEpoch = QDateTime::currentMSecsSinceEpoch(); }
+
+        const quint64 key = this->cellKey(coordinate);
+        const quint64 sequence = m_nextSequence++;
+        m_cells[key].push_back({ CCoordinateGeodetic(coordinate), timestampMsSinceEpoch, sequence });
+        m_order.insert(sequence, key);
+    }
+
+    CCoordinateGeodeticList CCoordinateGeodeticGrid::toList() const
+    {
+        QHash<quint64, const Entry *> entries;
+        entries.reserve(m_order.size());
+        for (const Cell &cell : m_cells)
+        {
+            for (const Entry &entry : cell) { entries.insert(entry.sequence, &entry); }
+        }
+
+        CCoordinateGeodeticList coordinates;
+        coordinates.reserve(m_order.size());
+        for (auto it = m_order.keyEnd(); it != m_order.keyBegin();)
+        {
+            --it;
+            coordinates.push_back(entries.value(*it)->coordinate);
+        }
+        return coordinates;
+    }
+
+    CCoordinateGeodetic CCoordinateGeodeticGrid::findFirstWithinRangeOrDefault(const ICoordinateGeodetic &reference, const CLength &range) const
+    {
+        const QMap<quint64, const Entry *> entries = this->entriesWithinRange(reference, range);
+        if (entries.isEmpty()) { return {}; }
+        return entries.last()->coordinate;
+    }
+
+    CCoordinateGeodetic CCoordinateGeodeticGrid::findClosestWithinRange(const ICoordinateGeodetic &reference, const CLength &range) const
+    {
+        if (reference.isNull() || range.isNull()) { return {}; }
+        const Entry *closest = nullptr;
+        CLength distance = CLength::null();
+        this->forEachCandidate(reference, range, [&](const Entry & entry)
+        {
+            const CLength d = reference.calculateGreatCircleDistance(entry.coordinate);
+            if (d.isNull() || d > range) { return; }
+            if (distance.isNull() || d < distance || (d == distance && entry.sequence > closest->sequence))
+            {
+                distance = d;
+                closest = &entry;
+            }
+        });
+        return closest ? closest->coordinate : CCoordinateGeodetic();
+    }
+
+    CCoordinateGeodeticList CCoordinateGeodeticGrid::findWithinRange(const ICoordinateGeodetic &reference, const CLength &range) const
+    {
+        const QMap<quint64, const Entry *> entries = this->entriesWithinRange(reference, range);
+        CCoordinateGeodeticList coordinates;
+        coordinates.reserve(entries.size());
+        for (auto it = entries.cend(); it != entries.cbegin();)
+        {
+            --it;
+            coordinates.push_back((*it)->coordinate);
+        }
+        return coordinates;
+    }
+
+    CCoordinateGeodeticList CCoordinateGeodeticGrid::findClosest(int number, const ICoordinateGeodetic &reference) const
+    {
+        const QVector<const Entry *> entries = this->closestEntries(number, reference);
+        CCoordinateGeodeticList closest;
+        closest.reserve(entries.size());
+        for (const Entry *entry : entries) { closest.push_back(entry->coordinate); }
+        return closest;
+    }
+
+    CAltitude CCoordinateGeodeticGrid::findMaxHeight() const
+    {
+        CAltitude max = CAltitude::null();
+        for (const Cell &cell : m_cells)
+        {
+            for (const Entry &entry : cell)
+            {
+                if (!entry.coordinate.hasMSLGeodeticHeight()) { continue; }
+                const CAltitude alt = entry.coordinate.geodeticHeight();
+                if (max.isNull() || alt > max) { max = alt; }
+            }
+        }
+        return max;
+    }
+
+    int CCoordinateGeodeticGrid::removeInsideRange(const ICoordinateGeodetic &reference, const CLength &range)
+    {
+        const QList<quint64> sequences = this->entriesWithinRange(reference, range).keys();
+        for (quint64 sequence : sequences) { this->removeSequence(sequence); }
+        return sequences.size();
+    }
+
+    int CCoordinateGeodeticGrid::removeOutsideRange(const ICoordinateGeodetic &reference, const CLength &range)
+    {
+        const QMap<quint64, const Entry *> inside = this->entriesWithinRange(reference, range);
+        if (inside.size() == this->size()) { return 0; }
+        return this->removeIf([&](const Entry & entry) { return !inside.contains(entry.sequence); });
+    }
+
+    int CCoordinateGeodeticGrid::keepClosest(int number, const ICoordinateGeodetic &reference)
+    {
+        if (this->size() <= number) { return 0; }
+        QSet<quint64> keep;
+        for (const Entry *entry : this->closestEntries(number, reference)) { keep.insert(entry->sequence); }
+        return this->removeIf([&](const Entry & entry) { return !keep.contains(entry.sequence); });
+    }
+
+    int CCoordinateGeodeticGrid::keepLatest(int number)
+    {
+        int removed = 0;
+        while (this->size() > qMax(0, number))
+        {
+            this->removeSequence(m_order.firstKey());
+            removed++;
+        }
+        return removed;
+    }
+
+    int CCoordinateGeodeticGrid::removeOlderThan(qint64 timestampMsSinceEpoch)
+    {
+        return this->removeIf([&](const Entry & entry) { return entry.timestampMs < timestampMsSinceEpoch; });
+    }
+
+    quint64 CCoordinateGeodeticGrid::cellKey(const ICoordinateGeodetic &coordinate) const
+    {
+        const double lat = coordinate.latitude().value(CAngleUnit::deg());
+        const double lon = coordinate.longitude().value(CAngleUnit::deg());
+        const int latIndex = static_cast<int>(std::floor((lat + 90.0) / m_cellDegrees));
+        const int lonIndex = static_cast<int>(std::floor((lon + 180.0) / m_cellDegrees));
+        return cellKey(latIndex, ((lonIndex % m_lonCells) + m_lonCells) % m_lonCells);
+    }
+
+    quint64 CCoordinateGeodeticGrid::cellKey(int latIndex, int lonIndex)
+    {
+        return (static_cast<quint64>(static_cast<quint32>(latIndex)) << 32) | static_cast<quint32>(lonIndex);
+    }
+
+    bool CCoordinateGeodeticGrid::cellKeys(const ICoordinateGeodetic &reference, const CLength &range, QVector<quint64> &keys) const
+    {
+        keys.clear();
+        const double lat = reference.latitude().value(CAngleUnit::deg());
+        const double lon = reference.longitude().value(CAngleUnit::deg());
+        const double dLat = (range.value(CLengthUnit::m()) + MarginMeters) / MetersPerDegree;
+        const double latMin = lat - dLat;
+        const double latMax = lat + dLat;
+        if (latMin <= -90.0 || latMax >= 90.0) { return false; } // pole within range
+
+        const double dLon = dLat / std::cos(qMax(qAbs(latMin), qAbs(latMax)) * M_PI / 180.0);
+        if (dLon >= 180.0) { return false; }
+
+        const int latFrom = static_cast<int>(std::floor((latMin + 90.0) / m_cellDegrees));
+        const int latTo   = static_cast<int>(std::floor((latMax + 90.0) / m_cellDegrees));
+        const int lonFrom = static_cast<int>(std::floor((lon - dLon + 180.0) / m_cellDegrees));
+        const int lonTo   = static_cast<int>(std::floor((lon + dLon + 180.0) / m_cellDegrees));
+        const qint64 lonCount = qMin<qint64>(lonTo - lonFrom + 1, m_lonCells);
+
+        // more cells than populated ones, cheaper to search all
+        if (static_cast<qint64>(latTo - latFrom + 1) * lonCount > m_cells.size()) { return false; }
+
+        keys.reserve(static_cast<int>((latTo - latFrom + 1) * lonCount));
+        for (int latIndex = latFrom; latIndex <= latTo; ++latIndex)
+        {
+            for (int i = 0; i < lonCount; ++i)
+            {
+                const int lonIndex = (((lonFrom + i) % m_lonCells) + m_lonCells) % m_lonCells;
+                keys.push_back(cellKey(latIndex, lonIndex));
+            }
+        }
+        return true;
+    }
+
+    template <typename F>
+    void CCoordinateGeodeticGrid::forEachCandidate(const ICoordinateGeodetic &reference, const CLength &range, F function) const
+    {
+        QVector<quint64> keys;
+        if (this->cellKeys(reference, range, keys))
+        {
+            for (quint64 key : std::as_const(keys))
+            {
+                const auto it = m_cells.constFind(key);
+                if (it == m_cells.constEnd()) { continue; }
+                for (const Entry &entry : *it) { function(entry); }
+            }
+        }
+        else
+        {
+            for (const Cell &cell : m_cells)
+            {
+                for (const Entry &entry : cell) { function(entry); }
+            }
+        }
+    }
+
+    QMap<quint64, const CCoordinateGeodeticGrid::Entry *> CCoordinateGeodeticGrid::entriesWithinRange(const ICoordinateGeodetic &reference, const CLength &range) const
+    {
+        QMap<quint64, const Entry *> entries;
+        if (reference.isNull() || range.isNull()) { return entries; }
+        this->forEachCandidate(reference, range, [&](const Entry & entry)
+        {
+            const CLength d = calculateGreatCircleDistance(entry.coordinate, reference);
+            if (!d.isNull() && d <= range) { entries.insert(entry.sequence, &entry); }
+        });
+        return entries;
+    }
+
+    QVector<const CCoordinateGeodeticGrid::Entry *> CCoordinateGeodeticGrid::closestEntries(int number, const ICoordinateGeodetic &reference) const
+    {
+        QVector<const Entry *> candidates;
+        if (number <= 0 || reference.isNull() || this->isEmpty()) { return candidates; }
+
+        // grow the radius until there are enough candidates, all closer ones are within that radius
+        const int wanted = qMin(number, this->size());
+        for (double radiusM = m_cellDegrees * MetersPerDegree; ; radiusM *= 4.0)
+        {
+            const bool all = radiusM >= HalfCircumferenceMeters;
+            const QMap<quint64, const Entry *> entries = this->entriesWithinRange(reference, CLength(all ? HalfCircumferenceMeters + MarginMeters : radiusM, CLengthUnit::m()));
+            if (entries.size() >= wanted || all)
+            {
+                candidates.reserve(entries.size());
+                for (auto it = entries.cend(); it != entries.cbegin();) { --it; candidates.push_back(*it); }
+                break;
+            }
+        }
+
+        // latest first for equal distances, like in a list with the latest at front
+        QVector<double> distances;
+        distances.reserve(candidates.size());
+        for (const Entry *entry : std::as_const(candidates)) { distances.push_back(calculateEuclideanDistanceSquared(entry->coordinate, reference)); }
+        QVector<int> order(candidates.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return distances[a] < distances[b]; });
+
+        QVector<const Entry *> closest;
+        closest.reserve(wanted);
+        for (int i = 0; i < order.size() && i < wanted; ++i) { closest.push_back(candidates[order[i]]); }
+        return closest;
+    }
+
+    template <typename Predicate>
+    int CCoordinateGeodeticGrid::removeIf(Predicate predicate)
+    {
+        int removed = 0;
+        for (auto cellIt = m_cells.begin(); cellIt != m_cells.end();)
+        {
+            Cell &cell = *cellIt;
+            for (auto it = cell.begin(); it != cell.end();)
+            {
+                if (predicate(*it))
+                {
+                    m_order.remove(it->sequence);
+                    it = cell.erase(it);
+                    removed++;
+                }
+                else { ++it; }
+            }
+            if (cell.isEmpty()) { cellIt = m_cells.erase(cellIt); }
+            else { ++cellIt; }
+        }
+        return removed;
+    }
+
+    void CCoordinateGeodeticGrid::removeSequence(quint64 sequence)
+    {
+        const auto orderIt = m_order.find(sequence);
+        if (orderIt == m_order.end()) { return; }
+        const auto cellIt = m_cells.find(*orderIt);
+        m_order.erase(orderIt);
+        if (cellIt == m_cells.end()) { return; }
+
+        Cell &cell = *cellIt;
+        cell.erase(std::remove_if(cell.begin(), cell.end(), [&](const Entry & entry) { return entry.sequence == sequence; }), cell.end());
+        if (cell.isEmpty()) { m_cells.erase(cellIt); }
+    }
+} // namespace
@@ -0,0 +1,129 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_GEO_COORDINATEGEODETICGRID_H
+#define BLACKMISC_GEO_COORDINATEGEODETICGRID_H
+
+#include "blackmisc/geo/coordinategeodeticlist.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/aviation/altitude.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QHash>
+#include <QMap>
+#include <QVector>
+#include <QtGlobal>
+
+namespace BlackMisc::Geo
+{
+    //! Coordinates in a latitude/longitude grid, for radius and k-nearest queries without scanning all coordinates
+    //! \remark Range queries only calculate distances for coordinates in grid cells overlapping the range,
+    //!         the distances are the same great circle distances as used by CCoordinateGeodeticList.
+    //! \remark Coordinates are kept in insertion order, so the oldest can be evicted.
+    class BLACKMISC_EXPORT CCoordinateGeodeticGrid
+    {
+    public:
+        //! Default cell size, about 1.1km in latitude
+        static constexpr double DefaultCellDegrees = 0.01;
+
+        //! Constructor
+        explicit CCoordinateGeodeticGrid(double cellDegrees = DefaultCellDegrees);
+
+        //! Number of coordinates
+        int size() const { return m_order.size(); }
+
+        //! Empty?
+        bool isEmpty() const { return m_order.isEmpty(); }
+
+        //! Remove all coordinates
+        void clear();
+
+        //! Insert coordinate
+        //! \remark timestamp -1 means now
+        void insert(const ICoordinateGeodetic &coordinate, qint64 timestampMsSinceEpoch = -1);
+
+        //! All coordinates, latest first
+        CCoordinateGeodeticList toList() const;
+
+        //! Latest coordinate within range, or default
+        CCoordinateGeodetic findFirstWithinRangeOrDefault(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range) const;
+
+        //! Closest coordinate within range, or default
+        CCoordinateGeodetic findClosestWithinRange(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range) const;
+
+        //! All coordinates within range, latest first
+        CCoordinateGeodeticList findWithinRange(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range) const;
+
+        //! The number closest coordinates, closest first
+        CCoordinateGeodeticList findClosest(int number, const ICoordinateGeodetic &reference) const;
+
+        //! Max. height of all coordinates
+        Aviation::CAltitude findMaxHeight() const;
+
+        //! Remove coordinates within range
+        int removeInsideRange(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range);
+
+        //! Remove coordinates outside range
+        int removeOutsideRange(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range);
+
+        //! Only keep the number closest coordinates
+        int keepClosest(int number, const ICoordinateGeodetic &reference);
+
+        //! Only keep the number latest coordinates
+        int keepLatest(int number);
+
+        //! Remove coordinates inserted before timestamp
+        int removeOlderThan(qint64 timestampMsSinceEpoch);
+
+    private:
+        //! Coordinate in a cell
+        struct Entry
+        {
+            CCoordinateGeodetic coordinate; //!< coordinate
+            qint64 timestampMs = -1;        //!< when inserted
+            quint64 sequence = 0;           //!< insertion order
+        };
+
+        using Cell = QVector<Entry>;
+
+        //! Key of cell containing coordinate
+        quint64 cellKey(const ICoordinateGeodetic &coordinate) const;
+
+        //! Key of cell by indexes
+        static quint64 cellKey(int latIndex, int lonIndex);
+
+        //! Keys of cells overlapping range, false if all cells have to be searched
+        bool cellKeys(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range, QVector<quint64> &keys) const;
+
+        //! Call function for each entry in cells overlapping range
+        template <typename F> void forEachCandidate(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range, F function) const;
+
+        //! Entries within range, ordered by sequence
+        QMap<quint64, const Entry *> entriesWithinRange(const ICoordinateGeodetic &reference, const PhysicalQuantities::CLength &range) const;
+
+        //! The number closest entries, closest first
+        QVector<const Entry *> closestEntries(int number, const ICoordinateGeodetic &reference) const;
+
+        //! Remove entries matching predicate
+        template <typename Predicate> int removeIf(Predicate predicate);
+
+        //! Remove entry by sequence
+        void removeSequence(quint64 sequence);
+
+        double m_cellDegrees = DefaultCellDegrees;
+        int m_lonCells = 0;                 //!< number of cells around the globe
+        QHash<quint64, Cell> m_cells;       //!< cells by key
+        QMap<quint64, quint64> m_order;     //!< sequence -> cell key, oldest first
+        quint64 m_nextSequence = 0;
+    };
+} // namespace
+
+#endif // guard
@@ -0,0 +1,127 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/geo/geoobjectindex.h"
+#include "blackmisc/pq/units.h"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <utility>
+#include <vector>
+
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Geo
+{
+    CGeoKdTree::CGeoKdTree(const QVector<Vector> &vectors)
+    {
+        m_nodes.reserve(vectors.size());
+        int p = 0;
+        for (const Vector &v : vectors) { m_nodes.push_back({ v, p++ }); }
+        this->build(0, m_nodes.size(), 0);
+    }
+
+    QVector<int> CGeoKdTree::withinChordSquared(const Vector &reference, double maxChordSquared) const
+    {
+        QVector<int> positions;
+        if (maxChordSquared < 0) { return positions; }
+        this->withinChordSquared(0, m_nodes.size(), 0, reference, maxChordSquared, positions);
+        std::sort(positions.begin(), positions.end());
+        return positions;
+    }
+
+    QVector<int> CGeoKdTree::closest(int number, const Vector &reference) const
+    {
+        QVector<int> positions;
+        if (number < 1 || m_nodes.isEmpty()) { return positions; }
+
+        // max. heap of the closest so far, the farthest on top
+        using Candidate = std::pair<double, int>;
+        std::priority_queue<Candidate> heap;
+
+        // subtree and min. squared distance to its half space
+        struct Range { int begin; int end; int depth; double bound; };
+        std::vector<Range> stack { { 0, m_nodes.size(), 0, 0.0 } };
+        while (!stack.empty())
+        {
+            const Range r = stack.back();
+            stack.pop_back();
+            if (r.begin >= r.end) { continue; }
+            if (static_cast<int>(heap.size()) >= number && r.bound >= heap.top().first) { continue; }
+
+            const int mid = (r.begin + r.end) / 2;
+            const Node &node = m_nodes[mid];
+            const double d2 = chordSquared(node.vector, reference);
+            if (static_cast<int>(heap.size()) < number) { heap.push({ d2, node.position }); }
+            else if (d2 < heap.top().first) { heap.pop(); heap.push({ d2, node.position }); }
+
+            const int axis = r.depth % 3;
+            const double delta = reference[axis] - node.vector[axis];
+            const Range nearSide = delta < 0 ? Range { r.begin, mid, r.depth + 1, r.bound } : Range { mid + 1, r.end, r.depth + 1, r.bound };
+            const Range farSide  = delta < 0 ? Range { mid + 1, r.end, r.depth + 1, qMax(r.bound, delta * delta) } : Range { r.begin, mid, r.depth + 1, qMax(r.bound, delta * delta) };
+
+            // near side is searched first, so the far side is likely skipped
+            stack.push_back(farSide);
+            stack.push_back(nearSide);
+        }
+
+        positions.resize(static_cast<int>(heap.size()));
+        for (int i = positions.size() - 1; i >= 0; --i)
+        {
+            positions[i] = heap.top().second;
+            heap.pop();
+        }
+        return positions;
+    }
+
+    double CGeoKdTree::chordSquared(const CLength &greatCircleDistance)
+    {
+        if (greatCircleDistance.isNull()) { return -1.0; }
+        constexpr double EarthRadiusMeters = 6371000.8; // as calculateGreatCircleDistance
+        constexpr double MarginMeters = 10.0;           // float precision of calculateGreatCircleDistance
+        const double angle = (greatCircleDistance.value(CLengthUnit::m()) + MarginMeters) / EarthRadiusMeters;
+        if (angle >= M_PI) { return 4.0; }
+        const double chord = 2.0 * std::sin(angle / 2.0);
+        return chord * chord;
+    }
+
+    double CGeoKdTree::chordSquared(const Vector &v1, const Vector &v2)
+    {
+        const double dx = v1[0] - v2[0];
+        const double dy = v1[1] - v2[1];
+        const double dz = v1[2] - v2[2];
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    void CGeoKdTree::build(int begin, int end, int depth)
+    {
+        if (end - begin < 2) { return; }
+        const int mid = (begin + end) / 2;
+        const int axis = depth % 3;
+        std::nth_element(m_nodes.begin() + begin, m_nodes.begin() + mid, m_nodes.begin() + end, [axis](const Node & a, const Node & b)
+        {
+            return a.vector[axis] < b.vector[axis];
+        });
+        this->build(begin, mid, depth + 1);
+        this->build(mid + 1, end, depth + 1);
+    }
+
+    void CGeoKdTree::withinChordSquared(int begin, int end, int depth, const Vector &reference, double maxChordSquared, QVector<int> &positions) const
+    {
+        if (begin >= end) { return; }
+        const int mid = (begin + end) / 2;
+        const Node &node = m_nodes[mid];
+        if (chordSquared(node.vector, reference) <= maxChordSquared) { positions.push_back(node.position); }
+
+        const int axis = depth % 3;
+        const double delta = reference[axis] - node.vector[axis];
+        if (delta <= 0 || delta * delta <= maxChordSquared) { this->withinChordSquared(begin, mid, depth + 1, reference, maxChordSquared, positions); }
+        if (delta >= 0 || delta * delta <= maxChordSquared) { this->withinChordSquared(mid + 1, end, depth + 1, reference, maxChordSquared, positions); }
+    }
+} // namespace
@@ -0,0 +1,152 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_GEO_GEOOBJECTINDEX_H
+#define BLACKMISC_GEO_GEOOBJECTINDEX_H
+
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QVector>
+#include <array>
+
+namespace BlackMisc::Geo
+{
+    //! k-d tree over normal vectors, positions refer to the vectors the tree was built from
+    //! \remark The euclidean (chord) distance of normal vectors grows with the great circle distance,
+    //!         so the closest vectors are also the closest on the globe.
+    class BLACKMISC_EXPORT CGeoKdTree
+    {
+    public:
+        //! Normal vector
+        using Vector = std::array<double, 3>;
+
+        //! Default constructor, empty tree
+        CGeoKdTree() = default;
+
+        //! Build tree
+        explicit CGeoKdTree(const QVector<Vector> &vectors);
+
+        //! Number of vectors
+        int size() const { return m_nodes.size(); }
+
+        //! Positions with a squared chord distance <= maxChordSquared, ascending
+        QVector<int> withinChordSquared(const Vector &reference, double maxChordSquared) const;
+
+        //! Positions of the number closest vectors, closest first
+        QVector<int> closest(int number, const Vector &reference) const;
+
+        //! Squared chord distance for a great circle distance, with a margin for the float precision of calculateGreatCircleDistance
+        static double chordSquared(const PhysicalQuantities::CLength &greatCircleDistance);
+
+        //! Squared chord distance of two normal vectors
+        static double chordSquared(const Vector &v1, const Vector &v2);
+
+    private:
+        //! Vector and its position
+        struct Node
+        {
+            Vector vector;     //!< normal vector
+            int position = -1; //!< position in the vectors the tree was built from
+        };
+
+        //! Build subtree of [begin, end), median at the middle
+        void build(int begin, int end, int depth);
+
+        //! Collect positions within distance
+        void withinChordSquared(int begin, int end, int depth, const Vector &reference, double maxChordSquared, QVector<int> &positions) const;
+
+        QVector<Node> m_nodes; //!< implicit tree, each subtree [begin, end) has its node at (begin + end) / 2
+    };
+
+    //! Spatial index of a list of geo objects, for range and closest queries without scanning the list
+    //! \remark Like CAircraftModelSetIndex, the index keeps an implicitly shared copy of the list,
+    //!         isIndexOf tells if it is still up to date.
+    //! \remark The results are the same as the corresponding IGeoObjectList functions called on the indexed list,
+    //!         objects with equal distances may be in a different order. Objects without position are never found.
+    template <class CONTAINER>
+    class CGeoObjectIndex
+    {
+    public:
+        //! Indexed object
+        using OBJ = typename CONTAINER::value_type;
+
+        //! Default constructor, empty index
+        CGeoObjectIndex() = default;
+
+        //! Build index of objects
+        explicit CGeoObjectIndex(const CONTAINER &objects) : m_objects(objects)
+        {
+            QVector<CGeoKdTree::Vector> vectors;
+            vectors.reserve(m_objects.size());
+            int p = 0;
+            for (const OBJ &obj : m_objects)
+            {
+                const CGeoKdTree::Vector v = obj.normalVectorDouble();
+                if (v[0] != 0.0 || v[1] != 0.0 || v[2] != 0.0)
+                {
+                    vectors.push_back(v);
+                    m_positions.push_back(p);
+                }
+                p++;
+            }
+            m_tree = CGeoKdTree(vectors);
+        }
+
+        //! Indexed objects
+        const CONTAINER &getObjects() const { return m_objects; }
+
+        //! Is objects the (implicitly shared and unmodified) list this index was built from?
+        //! \remark cheap, compares size and data
+        bool isIndexOf(const CONTAINER &objects) const
+        {
+            if (objects.size() != m_objects.size()) { return false; }
+            if (objects.isEmpty()) { return true; }
+            return &*objects.cbegin() == &*m_objects.cbegin();
+        }
+
+        //! \copydoc IGeoObjectList::findWithinRange
+        CONTAINER findWithinRange(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range) const
+        {
+            CONTAINER result;
+            if (range.isNull()) { return result; }
+            for (int p : m_tree.withinChordSquared(coordinate.normalVectorDouble(), CGeoKdTree::chordSquared(range)))
+            {
+                const OBJ &obj = m_objects[m_positions[p]];
+                if (calculateGreatCircleDistance(obj, coordinate) <= range) { result.push_back(obj); }
+            }
+            return result;
+        }
+
+        //! \copydoc IGeoObjectList::findClosest
+        CONTAINER findClosest(int number, const ICoordinateGeodetic &coordinate) const
+        {
+            CONTAINER result;
+            for (int p : m_tree.closest(number, coordinate.normalVectorDouble())) { result.push_back(m_objects[m_positions[p]]); }
+            return result;
+        }
+
+        //! \copydoc IGeoObjectList::findClosestWithinRange
+        OBJ findClosestWithinRange(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range) const
+        {
+            const CONTAINER closest = this->findClosest(1, coordinate);
+            if (closest.isEmpty() || coordinate.calculateGreatCircleDistance(closest.front()) > range) { return OBJ(); }
+            return closest.front();
+        }
+
+    private:
+        CONTAINER m_objects;        //!< indexed objects
+        QVector<int> m_positions;   //!< tree position -> position in m_objects, objects without coordinate are not in the tree
+        CGeoKdTree m_tree;          //!< tree
+    };
+} // namespace
+
+#endif // guard
@@ -16,9 +16,14 @@
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/sequence.h"
 #include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/geo/greatcirclekernel.h"
 
 #include <QList>
+#include <QVector>
+#include <algorithm>
+#include <array>
 #include <tuple>
+#include <utility>
 
 namespace BlackMisc::Geo
 {
@@ -269,9 +274,12 @@ namespace BlackMisc::Geo
 
         //! If distance is already set, just sort container
         //! \remark requires calculcateAndUpdateRelativeDistanceAndBearing
+        //! \remark a list still in order (nothing moved past another object) is not sorted again
         void sortByDistanceToReferencePosition()
         {
-            this->container().sort([&](const OBJ & a, const OBJ & b) { return a.getRelativeDistance() < b.getRelativeDistance(); });
+            const auto byDistance = [](const OBJ & a, const OBJ & b) { return a.getRelativeDistance() < b.getRelativeDistance(); };
+            if (std::is_sorted(this->container().cbegin(), this->container().cend(), byDistance)) { return; }
+            this->container().sort(byDistance);
         }
 
         //! Sort the first n closest objects
@@ -302,19 +310,59 @@ namespace BlackMisc::Geo
             });
         }
 
-        //! Calculate distances
+        //! Calculate distances and bearings
+        //! \remark same values as ICoordinateWithRelativePosition::calculcateAndUpdateRelativeDistanceAndBearing,
+        //!         calculated for all objects in one pass by calculateGreatCircleDistancesAndBearings
         void calculcateAndUpdateRelativeDistanceAndBearing(const ICoordinateGeodetic &position)
         {
-            for (OBJ &geoObj : this->container())
-            {
-                geoObj.calculcateAndUpdateRelativeDistanceAndBearing(position);
-            }
+            this->calculcateAndUpdateRelativeValues(position, true);
+        }
+
+        //! Calculate distances only, bearings are kept
+        void calculcateAndUpdateRelativeDistance(const ICoordinateGeodetic &position)
+        {
+            this->calculcateAndUpdateRelativeValues(position, false);
         }
 
     protected:
         //! Constructor
         IGeoObjectWithRelativePositionList()
         { }
+
+    private:
+        //! Calculate distances and optionally bearings, objects without position get null values
+        void calculcateAndUpdateRelativeValues(const ICoordinateGeodetic &position, bool withBearing)
+        {
+            if (this->container().isEmpty()) { return; }
+            const bool nullPosition = position.isNull();
+            QVector<std::array<double, 3>> vectors;
+            if (!nullPosition)
+            {
+                vectors.reserve(this->container().size());
+                for (const OBJ &geoObj : std::as_const(this->container()))
+                {
+                    if (!geoObj.isNull()) { vectors.push_back(geoObj.normalVectorDouble()); }
+                }
+            }
+
+            QVector<double> distances(vectors.size());
+            QVector<double> bearings(withBearing ? vectors.size() : 0);
+            calculateGreatCircleDistancesAndBearings(position.normalVectorDouble(), vectors.constData(), vectors.size(), distances.data(), withBearing ? bearings.data() : nullptr);
+
+            int i = 0;
+            for (OBJ &geoObj : this->container())
+            {
+                if (nullPosition || geoObj.isNull())
+                {
+                    geoObj.setRelativeDistance(PhysicalQuantities::CLength::null());
+                    if (withBearing) { geoObj.setRelativeBearing(PhysicalQuantities::CAngle::null()); }
+                    continue;
+                }
+                geoObj.setRelativeDistance(PhysicalQuantities::CLength(distances[i], PhysicalQuantities::CLengthUnit::m()));
+                if (withBearing) { geoObj.setRelativeBearing(PhysicalQuantities::CAngle(bearings[i], PhysicalQuantities::CAngleUnit::rad())); }
+                i++;
+            }
+        }
     };
 } // namespace
 
@@ -0,0 +1,131 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/geo/greatcirclekernel.h"
+
+#if defined(__AVX2__)
+#   define BLACK_GREATCIRCLEKERNEL_AVX2
+#   include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define BLACK_GREATCIRCLEKERNEL_SSE2
+#   include <emmintrin.h>
+#endif
+
+namespace BlackMisc::Geo
+{
+    namespace
+    {
+        //! \private Scalar calculation of [from, n)
+        void calculateScalar(const std::array<double, 3> &reference, const std::array<double, 3> *vectors, int from, int n, double *distances, double *bearings)
+        {
+            double bearing = 0.0;
+            for (int i = from; i < n; ++i)
+            {
+                calculateGreatCircleDistanceAndBearing(vectors[i], reference, distances[i], bearings ? bearings[i] : bearing);
+            }
+        }
+
+        //! \private atan2 of lanes calculated by SIMD instructions, there is no SIMD atan2
+        template <int Lanes>
+        void storeAtan2(const double *distY, const double *distX, const double *sinTheta, const double *cosTheta, double *distances, double *bearings)
+        {
+            for (int k = 0; k < Lanes; ++k)
+            {
+                distances[k] = GreatCircleEarthRadiusMeters * std::atan2(distY[k], distX[k]);
+                if (bearings) { bearings[k] = std::atan2(sinTheta[k], cosTheta[k]); }
+            }
+        }
+    }
+
+    void calculateGreatCircleDistancesAndBearings(const std::array<double, 3> &reference, const std::array<double, 3> *vectors, int n, double *distances, double *bearings)
+    {
+        // same operations in the same order as calculateGreatCircleDistanceAndBearing (no FMA),
+        // cross and dot products are calculated for several vectors at once, atan2 per vector
+        int i = 0;
+#if defined(BLACK_GREATCIRCLEKERNEL_AVX2)
+        alignas(32) double distY[4], distX[4], sinTheta[4], cosTheta[4];
+        const __m256d rx = _mm256_set1_pd(reference[0]);
+        const __m256d ry = _mm256_set1_pd(reference[1]);
+        const __m256d rz = _mm256_set1_pd(reference[2]);
+        const __m256d signMask = _mm256_set1_pd(-0.0);
+        for (; i + 4 <= n; i += 4)
+        {
+            const std::array<double, 3> *v = vectors + i;
+            const __m256d vx = _mm256_set_pd(v[3][0], v[2][0], v[1][0], v[0][0]);
+            const __m256d vy = _mm256_set_pd(v[3][1], v[2][1], v[1][1], v[0][1]);
+            const __m256d vz = _mm256_set_pd(v[3][2], v[2][2], v[1][2], v[0][2]);
+            const __m256d c1x = _mm256_sub_pd(_mm256_mul_pd(vy, rz), _mm256_mul_pd(vz, ry));
+            const __m256d c1y = _mm256_sub_pd(_mm256_mul_pd(vz, rx), _mm256_mul_pd(vx, rz));
+            const __m256d c1z = _mm256_sub_pd(_mm256_mul_pd(vx, ry), _mm256_mul_pd(vy, rx));
+            const __m256d c1Len2 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(c1x, c1x), _mm256_mul_pd(c1y, c1y)), _mm256_mul_pd(c1z, c1z));
+            const __m256d dot = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(vx, rx), _mm256_mul_pd(vy, ry)), _mm256_mul_pd(vz, rz));
+            _mm256_store_pd(distY, _mm256_sqrt_pd(c1Len2));
+            _mm256_store_pd(distX, dot);
+            if (bearings)
+            {
+                const __m256d cx = _mm256_mul_pd(c1z, vx);
+                const __m256d cy = _mm256_mul_pd(c1z, vy);
+                const __m256d cz = _mm256_sub_pd(_mm256_xor_pd(_mm256_mul_pd(c1x, vx), signMask), _mm256_mul_pd(c1y, vy));
+                const __m256d cLen2 = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(cx, cx), _mm256_mul_pd(cy, cy)), _mm256_mul_pd(cz, cz));
+                const __m256d cDot = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(cx, vx), _mm256_mul_pd(cy, vy)), _mm256_mul_pd(cz, vz));
+                _mm256_store_pd(sinTheta, _mm256_or_pd(_mm256_sqrt_pd(cLen2), _mm256_and_pd(cDot, signMask))); // copysign
+                _mm256_store_pd(cosTheta, _mm256_sub_pd(_mm256_mul_pd(c1x, vy), _mm256_mul_pd(c1y, vx)));
+            }
+            storeAtan2<4>(distY, distX, sinTheta, cosTheta, distances + i, bearings ? bearings + i : nullptr);
+        }
+#elif defined(BLACK_GREATCIRCLEKERNEL_SSE2)
+        alignas(16) double distY[2], distX[2], sinTheta[2], cosTheta[2];
+        const __m128d rx = _mm_set1_pd(reference[0]);
+        const __m128d ry = _mm_set1_pd(reference[1]);
+        const __m128d rz = _mm_set1_pd(reference[2]);
+        const __m128d signMask = _mm_set1_pd(-0.0);
+        for (; i + 2 <= n; i += 2)
+        {
+            const std::array<double, 3> *v = vectors + i;
+            const __m128d vx = _mm_set_pd(v[1][0], v[0][0]);
+            const __m128d vy = _mm_set_pd(v[1][1], v[0][1]);
+            const __m128d vz = _mm_set_pd(v[1][2], v[0][2]);
+            const __m128d c1x = _mm_sub_pd(_mm_mul_pd(vy, rz), _mm_mul_pd(vz, ry));
+            const __m128d c1y = _mm_sub_pd(_mm_mul_pd(vz, rx), _mm_mul_pd(vx, rz));
+            const __m128d c1z = _mm_sub_pd(_mm_mul_pd(vx, ry), _mm_mul_pd(vy, rx));
+            const __m128d c1Len2 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(c1x, c1x), _mm_mul_pd(c1y, c1y)), _mm_mul_pd(c1z, c1z));
+            const __m128d dot = _mm_add_pd(_mm_add_pd(_mm_mul_pd(vx, rx), _mm_mul_pd(vy, ry)), _mm_mul_pd(vz, rz));
+            _mm_store_pd(distY, _mm_sqrt_pd(c1Len2));
+            _mm_store_pd(distX, dot);
+            if (bearings)
+            {
+                const __m128d cx = _mm_mul_pd(c1z, vx);
+                const __m128d cy = _mm_mul_pd(c1z, vy);
+                const __m128d cz = _mm_sub_pd(_mm_xor_pd(_mm_mul_pd(c1x, vx), signMask), _mm_mul_pd(c1y, vy));
+                const __m128d cLen2 = _mm_add_pd(_mm_add_pd(_mm_mul_pd(cx, cx), _mm_mul_pd(cy, cy)), _mm_mul_pd(cz, cz));
+                const __m128d cDot = _mm_add_pd(_mm_add_pd(_mm_mul_pd(cx, vx), _mm_mul_pd(cy, vy)), _mm_mul_pd(cz, vz));
+                _mm_store_pd(sinTheta, _mm_or_pd(_mm_sqrt_pd(cLen2), _mm_and_pd(cDot, signMask))); // copysign
+                _mm_store_pd(cosTheta, _mm_sub_pd(_mm_mul_pd(c1x, vy), _mm_mul_pd(c1y, vx)));
+            }
+            storeAtan2<2>(distY, distX, sinTheta, cosTheta, distances + i, bearings ? bearings + i : nullptr);
+        }
+#endif
+        calculateScalar(reference, vectors, i, n, distances, bearings); // remainder
+    }
+
+    void calculateGreatCircleDistancesAndBearingsScalar(const std::array<double, 3> &reference, const std::array<double, 3> *vectors, int n, double *distances, double *bearings)
+    {
+        calculateScalar(reference, vectors, 0, n, distances, bearings);
+    }
+
+    const char *greatCircleKernelInstructionSet()
+    {
+#if defined(BLACK_GREATCIRCLEKERNEL_AVX2)
+        return "AVX2";
+#elif defined(BLACK_GREATCIRCLEKERNEL_SSE2)
+        return "SSE2";
+#else
+        return "scalar";
+#endif
+    }
+} // ns
@@ -0,0 +1,60 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_GEO_GREATCIRCLEKERNEL_H
+#define BLACKMISC_GEO_GREATCIRCLEKERNEL_H
+
+#include "blackmisc/blackmiscexport.h"
+
+#include <array>
+#include <cmath>
+
+namespace BlackMisc::Geo
+{
+    //! Earth radius as used by calculateGreatCircleDistance
+    constexpr double GreatCircleEarthRadiusMeters = 6371000.8;
+
+    //! Great circle distance [m] and bearing [rad] from normal vector v to reference
+    //! \remark same formulas as calculateGreatCircleDistance and calculateBearing, but in double precision,
+    //!         scalar reference of calculateGreatCircleDistancesAndBearings
+    inline void calculateGreatCircleDistanceAndBearing(const std::array<double, 3> &v, const std::array<double, 3> &reference, double &distanceMeters, double &bearingRadians)
+    {
+        // c1 = v x reference, c2 = v x north pole
+        const double c1x = v[1] * reference[2] - v[2] * reference[1];
+        const double c1y = v[2] * reference[0] - v[0] * reference[2];
+        const double c1z = v[0] * reference[1] - v[1] * reference[0];
+        distanceMeters = GreatCircleEarthRadiusMeters * std::atan2(std::sqrt(c1x * c1x + c1y * c1y + c1z * c1z), v[0] * reference[0] + v[1] * reference[1] + v[2] * reference[2]);
+
+        // cross = c1 x c2 with c2 = (v[1], -v[0], 0)
+        const double cx = c1z * v[0];
+        const double cy = c1z * v[1];
+        const double cz = -c1x * v[0] - c1y * v[1];
+        const double sinTheta = std::copysign(std::sqrt(cx * cx + cy * cy + cz * cz), cx * v[0] + cy * v[1] + cz * v[2]);
+        const double cosTheta = c1x * v[1] - c1y * v[0];
+        bearingRadians = std::atan2(sinTheta, cosTheta);
+    }
+
+    //! Great circle distances [m] and bearings [rad] from n normal vectors to one reference
+    //! \param reference       normal vector of reference position
+    //! \param vectors         n normal vectors, zero vectors result in 0 values
+    //! \param n               number of vectors
+    //! \param distancesMeters n distances
+    //! \param bearingsRadians n bearings, or nullptr if only distances are needed
+    //! \remark uses AVX2 or SSE2 if available at compile time, otherwise calculateGreatCircleDistanceAndBearing
+    BLACKMISC_EXPORT void calculateGreatCircleDistancesAndBearings(const std::array<double, 3> &reference, const std::array<double, 3> *vectors, int n, double *distancesMeters, double *bearingsRadians);
+
+    //! Great circle distances and bearings with calculateGreatCircleDistanceAndBearing only
+    //! \private UNIT tests/benchmark only
+    BLACKMISC_EXPORT void calculateGreatCircleDistancesAndBearingsScalar(const std::array<double, 3> &reference, const std::array<double, 3> *vectors, int n, double *distancesMeters, double *bearingsRadians);
+
+    //! Name of the instruction set used by calculateGreatCircleDistancesAndBearings
+    BLACKMISC_EXPORT const char *greatCircleKernelInstructionSet();
+} // namespace
+#endif // guard
@@ -18,6 +18,17 @@
 #include <QStringList>
 #include <QMetaType>
 
+namespace BlackMisc
+{
+    //! Identifier sets are mostly used for membership tests, so they are stored in a sorted vector
+    template <>
+    struct TCollectionStorage<CIdentifier>
+    {
+        //! Storage type
+        using type = QFlatOrderedSet<CIdentifier>;
+    };
+}
+
 BLACK_DECLARE_COLLECTION_MIXINS(BlackMisc, CIdentifier, CIdentifierSet)
 
 namespace BlackMisc
@@ -0,0 +1,174 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_LOCKSTRIPEDHASH_H
+#define BLACKMISC_LOCKSTRIPEDHASH_H
+
+#include <QHash>
+#include <QList>
+#include <QReadWriteLock>
+#include <QtGlobal>
+#include <array>
+#include <utility>
+
+namespace BlackMisc
+{
+    /*!
+     * Hash split into stripes, each stripe guarded by its own read/write lock.
+     *
+     * Writers of keys in different stripes never block each other. Values are returned as copies,
+     * for Qt's implicitly shared containers this is a cheap and immutable snapshot taken under the lock.
+     * \threadsafe
+     */
+    template <typename K, typename V, int Stripes = 16>
+    class CLockStripedHash
+    {
+        static_assert(Stripes > 0, "Need at least one stripe");
+
+    public:
+        //! Default constructor
+        CLockStripedHash() = default;
+
+        //! Not copyable, contains locks
+        //! @{
+        CLockStripedHash(const CLockStripedHash &) = delete;
+        CLockStripedHash &operator =(const CLockStripedHash &) = delete;
+        //! @}
+
+        //! Copy of the value, or defaultValue if key does not exist
+        V value(const K &key, const V &defaultValue = V()) const
+        {
+            const Stripe &s = this->stripe(key);
+            QReadLocker l(&s.lock);
+            return s.hash.value(key, defaultValue);
+        }
+
+        //! Contains key?
+        bool contains(const K &key) const
+        {
+            const Stripe &s = this->stripe(key);
+            QReadLocker l(&s.lock);
+            return s.hash.contains(key);
+        }
+
+        //! Call f(const V &) under the read lock, if the key exists
+        //! \return true if key exists
+        template <typename F>
+        bool read(const K &key, F &&f) const
+        {
+            const Stripe &s = this->stripe(key);
+            QReadLocker l(&s.lock);
+            const auto it = s.hash.constFind(key);
+            if (it == s.hash.constEnd()) { return false; }
+            std::forward<F>(f)(it.value());
+            return true;
+        }
+
+        //! Call f(V &) under the write lock, a default constructed value is inserted if the key does not exist
+        //! \return result of f
+        template <typename F>
+        decltype(auto) modify(const K &key, F &&f)
+        {
+            Stripe &s = this->stripe(key);
+            QWriteLocker l(&s.lock);
+            return std::forward<F>(f)(s.hash[key]);
+        }
+
+        //! Call f(V &) under the write lock, if the key exists
+        //! \return true if key exists
+        template <typename F>
+        bool modifyIfExists(const K &key, F &&f)
+        {
+            Stripe &s = this->stripe(key);
+            QWriteLocker l(&s.lock);
+            const auto it = s.hash.find(key);
+            if (it == s.hash.end()) { return false; }
+            std::forward<F>(f)(it.value());
+            return true;
+        }
+
+        //! Insert or replace value
+        void insert(const K &key, const V &value)
+        {
+            Stripe &s = this->stripe(key);
+            QWriteLocker l(&s.lock);
+            s.hash.insert(key, value);
+        }
+
+        //! Remove key
+        //! \return true if removed
+        bool remove(const K &key)
+        {
+            Stripe &s = this->stripe(key);
+            QWriteLocker l(&s.lock);
+            return s.hash.remove(key) > 0;
+        }
+
+        //! Remove all values
+        void clear()
+        {
+            for (Stripe &s : m_stripes)
+            {
+                QWriteLocker l(&s.lock);
+                s.hash.clear();
+            }
+        }
+
+        //! Number of values
+        //! \remark stripes are counted one by one, concurrent writes may be missed
+        int size() const
+        {
+            int c = 0;
+            for (const Stripe &s : m_stripes)
+            {
+                QReadLocker l(&s.lock);
+                c += s.hash.size();
+            }
+            return c;
+        }
+
+        //! Call f(const K &, const V &) for all values, stripe by stripe under the read lock
+        template <typename F>
+        void forEach(F &&f) const
+        {
+            for (const Stripe &s : m_stripes)
+            {
+                QReadLocker l(&s.lock);
+                for (auto it = s.hash.constBegin(); it != s.hash.constEnd(); ++it) { f(it.key(), it.value()); }
+            }
+        }
+
+        //! All keys
+        QList<K> keys() const
+        {
+            QList<K> k;
+            this->forEach([&k](const K &key, const V &) { k.push_back(key); });
+            return k;
+        }
+
+    private:
+        //! One stripe
+        struct Stripe
+        {
+            mutable QReadWriteLock lock;
+            QHash<K, V> hash;
+        };
+
+        //! Stripe of key
+        //! @{
+        Stripe &stripe(const K &key) { return m_stripes[static_cast<size_t>(qHash(key) % static_cast<uint>(Stripes))]; }
+        const Stripe &stripe(const K &key) const { return m_stripes[static_cast<size_t>(qHash(key) % static_cast<uint>(Stripes))]; }
+        //! @}
+
+        std::array<Stripe, static_cast<size_t>(Stripes)> m_stripes;
+    };
+} // ns
+
+#endif
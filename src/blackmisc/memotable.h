@@ -14,10 +14,31 @@
 #include "blackmisc/dictionary.h"
 #include "blackmisc/sequence.h"
 
+#include <QHash>
+#include <type_traits>
+#include <utility>
+
 namespace BlackMisc
 {
+    namespace Private
+    {
+        //! \private Type of the DB key of T, void if T has no DB key.
+        template <typename T, typename = void>
+        struct TMemoDbKey { using type = void; };
+
+        //! \private Type of the DB key of T, void if T has no DB key.
+        template <typename T>
+        struct TMemoDbKey<T, std::void_t<decltype(std::declval<const T &>().getDbKey()), decltype(std::declval<const T &>().hasValidDbKey())>>
+        {
+            using type = std::decay_t<decltype(std::declval<const T &>().getDbKey())>;
+        };
+    }
+
     /*!
      * A data memoization pattern useful for compressing JSON representations of containers.
+     *
+     * Values are looked up by hash. Values with a valid DB key are first looked up by their key,
+     * which avoids hashing the whole value for the common case of DB objects.
      */
     template <typename T>
     class CMemoTable
@@ -26,11 +47,24 @@ namespace BlackMisc
         //! Return the index of a value, inserting it if it is not already in the table.
         int getIndex(const T &value)
         {
+            if constexpr (HasDbKey)
+            {
+                if (value.hasValidDbKey())
+                {
+                    const auto it = m_dbKeys.constFind(value.getDbKey());
+                    if (it != m_dbKeys.constEnd() && m_list[*it] == value) { return *it; }
+                }
+            }
+
             int &index = m_dict[value];
             if (! index)
             {
                 m_list.push_back(value);
                 index = m_list.size();
+                if constexpr (HasDbKey)
+                {
+                    if (value.hasValidDbKey()) { m_dbKeys.insert(value.getDbKey(), index - 1); }
+                }
             }
             return index - 1;
         }
@@ -42,8 +76,12 @@ namespace BlackMisc
         }
 
     private:
+        using DbKey = typename Private::TMemoDbKey<T>::type;
+        static constexpr bool HasDbKey = !std::is_void_v<DbKey>;
+
         CSequence<T> m_list;
-        CDictionary<T, int, QMap> m_dict;
+        CDictionary<T, int, QHash> m_dict;
+        QHash<std::conditional_t<HasDbKey, DbKey, int>, int> m_dbKeys; //!< index of a value with the DB key, unused without DB keys
     };
 
     /*!
@@ -67,6 +105,14 @@ namespace BlackMisc
             //! Return the values in the T table as a flat list.
             template <typename T>
             const CSequence<T> &getTable() const { return this->CMemoTable<T>::getTable(); }
+
+            //! Append the values of the other memoizer's tables which are not yet in these tables.
+            //! \remark merging the memoizers of consecutive chunks in order gives the same tables as memoizing all values in one memoizer
+            void mergeTables(const CMemoizer &other)
+            {
+                const auto merge = [this](const auto &table) { for (const auto &value : table) { this->maybeMemoize(value); } };
+                (merge(other.template getTable<Ts>()), ...);
+            }
         };
 
         //! Unmemoizer for Ts. Other types are passed through.
@@ -237,6 +237,9 @@ namespace BlackMisc
         //! Removes all elements in the sequence.
         void clear() { m_impl.clear(); }
 
+        //! Reserves storage for at least n elements.
+        void reserve(size_type n) { m_impl.reserve(n); }
+
         //! Changes the size of the sequence, if it is bigger than the given size.
         void truncate(size_type maxSize) { if (size() > maxSize) { erase(begin() + maxSize, end()); } }
 
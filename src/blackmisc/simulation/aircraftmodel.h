@@ -49,6 +49,8 @@ namespace BlackMisc
 
     namespace Simulation
     {
+        class CAircraftModelListBinary;
+
         //! DB ids
         struct DBTripleIds
         {
@@ -551,6 +553,8 @@ namespace BlackMisc
             static const QString &supportedParts();
 
         private:
+            friend class CAircraftModelListBinary;
+
             //! Common implemenation of all fromDatabaseJson functions
             static CAircraftModel fromDatabaseJsonBaseImpl(const QJsonObject &json, const QString &prefix, const Aviation::CAircraftIcaoCode &aircraftIcao, const Aviation::CLivery &livery, const CDistributor &distributor);
 
@@ -19,6 +19,7 @@
 #include "blackmisc/statusmessage.h"
 #include "blackmisc/stringutils.h"
 #include "blackmisc/setbuilder.h"
+#include "blackmisc/threadutils.h"
 #include "blackconfig/buildconfig.h"
 
 #include <QStringBuilder>
@@ -27,7 +28,11 @@
 #include <QMultiMap>
 #include <QFileInfo>
 #include <QDir>
+#include <QVector>
+#include <limits>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 using namespace BlackConfig;
 using namespace BlackMisc::Network;
@@ -923,7 +928,7 @@ namespace BlackMisc::Simulation
         if (this->isEmpty()) { return 0; }
         const int s = this->size();
         CAircraftModelList withModelStr;
-        for (const CAircraftModel &model : *this)
+        for (const CAircraftModel &model : std::as_const(*this))
         {
             if (!model.hasModelString()) { continue; }
             withModelStr.push_back(model);
@@ -939,7 +944,7 @@ namespace BlackMisc::Simulation
         if (this->isEmpty()) { return 0; }
         const int s = this->size();
         CAircraftModelList onlyIncluded;
-        for (const CAircraftModel &model : *this)
+        for (const CAircraftModel &model : std::as_const(*this))
         {
             if (model.getModelMode() == CAircraftModel::Exclude) { continue; }
             onlyIncluded.push_back(model);
@@ -1461,6 +1466,40 @@ namespace BlackMisc::Simulation
         return scoreMap;
     }
 
+    ScoredModels CAircraftModelList::scoreBest(const CAircraftModel &remoteModel, bool preferColorLiveries, bool ignoreZeroScores, int *scoredModels) const
+    {
+        // scores only, the models are copied once the best score is known
+        const int n = this->sizeInt();
+        QVector<int> scores(n);
+        int *const s = scores.data();
+
+        // calculateScore is const and does not log here, so chunks can be scored concurrently
+        constexpr int MinModelsPerThread = 1024;
+        forEachChunkParallel(n, parallelChunkCount(n, MinModelsPerThread), [&](int, int from, int to)
+        {
+            for (int i = from; i < to; ++i) { s[i] = (*this)[i].calculateScore(remoteModel, preferColorLiveries, nullptr); }
+        });
+
+        int bestScore = std::numeric_limits<int>::min();
+        int scored = 0;
+        for (int score : std::as_const(scores))
+        {
+            if (ignoreZeroScores && score < 1) { continue; }
+            scored++;
+            if (score > bestScore) { bestScore = score; }
+        }
+        if (scoredModels) { *scoredModels = scored; }
+
+        // same insertion order as scoreFull, so values(bestScore) is identical
+        ScoredModels scoreMap;
+        if (scored < 1) { return scoreMap; }
+        for (int i = 0; i < n; ++i)
+        {
+            if (s[i] == bestScore) { scoreMap.insertMulti(bestScore, (*this)[i]); }
+        }
+        return scoreMap;
+    }
+
     QStringList CAircraftModelList::toCompleterStrings(bool sorted, const CSimulatorInfo &simulator) const
     {
         QStringList c;
@@ -1672,12 +1711,51 @@ namespace BlackMisc::Simulation
 
     QJsonObject CAircraftModelList::toMemoizedJson() const
     {
-        CAircraftModel::MemoHelper::CMemoizer helper;
+        using CMemoizer = CAircraftModel::MemoHelper::CMemoizer;
+        CMemoizer helper;
         QJsonArray array;
-        for (auto it = cbegin(); it != cend(); ++it)
+
+        constexpr int MinModelsPerThread = 2048;
+        const int n = this->sizeInt();
+        const int chunks = parallelChunkCount(n, MinModelsPerThread);
+        if (chunks < 2)
+        {
+            for (auto it = cbegin(); it != cend(); ++it)
+            {
+                array << it->toMemoizedJson(helper);
+            }
+        }
+        else
         {
-            array << it->toMemoizedJson(helper);
+            // memoize the chunks, merged in order the tables are the same as memoized in one go
+            std::vector<CMemoizer> chunkHelpers(static_cast<size_t>(chunks));
+            forEachChunkParallel(n, chunks, [&](int c, int from, int to)
+            {
+                CMemoizer &chunkHelper = chunkHelpers[static_cast<size_t>(c)];
+                for (int i = from; i < to; ++i)
+                {
+                    const CAircraftModel &model = (*this)[i]; // the members memoized by CAircraftModel::MemoHelper
+                    chunkHelper.maybeMemoize(model.getAircraftIcaoCode());
+                    chunkHelper.maybeMemoize(model.getLivery());
+                    chunkHelper.maybeMemoize(model.getDistributor());
+                }
+            });
+            for (const CMemoizer &chunkHelper : chunkHelpers) { helper.mergeTables(chunkHelper); }
+
+            // every value is in the merged tables, each chunk looks up the indexes in its own copy
+            std::vector<QJsonArray> chunkArrays(static_cast<size_t>(chunks));
+            forEachChunkParallel(n, chunks, [&](int c, int from, int to)
+            {
+                CMemoizer chunkHelper(helper);
+                QJsonArray &chunkArray = chunkArrays[static_cast<size_t>(c)];
+                for (int i = from; i < to; ++i) { chunkArray << (*this)[i].toMemoizedJson(chunkHelper); }
+            });
+            for (const QJsonArray &chunkArray : chunkArrays)
+            {
+                for (const QJsonValue &value : chunkArray) { array << value; }
+            }
         }
+
         QJsonObject json;
         json.insert("containerbase", array);
         json.insert("aircraftIcaos", helper.getTable<CAircraftIcaoCode>().toJson());
@@ -1868,19 +1946,38 @@ namespace BlackMisc::Simulation
         const CAircraftIcaoCodeList &icaos,
         const CAircraftCategoryList &categories,
         const CLiveryList &liveries,
-        const CDistributorList &distributors
+        const CDistributorList &distributors,
+        const std::function<void(int)> &progress
     )
     {
-        AircraftIcaoIdMap aircraftIcaosMap = icaos.toDbKeyValueMap();
-        LiveryIdMap       liveriesMap = liveries.toDbKeyValueMap();
-        DistributorIdMap  distributorsMap = distributors.toDbKeyValueMap();
+        const AircraftIcaoIdMap     aircraftIcaosMap = icaos.toDbKeyValueMap();
+        const LiveryIdMap           liveriesMap = liveries.toDbKeyValueMap();
+        const DistributorIdMap      distributorsMap = distributors.toDbKeyValueMap();
         const AircraftCategoryIdMap categoriesMap = categories.toDbKeyValueMap();
 
+        // each chunk starts with the prebuilt maps and adds the objects only found in its own models
+        constexpr int MinModelsPerThread = 2048;
+        const int n = array.size();
+        const int chunks = parallelChunkCount(n, MinModelsPerThread);
+        std::vector<CAircraftModelList> chunkModels(static_cast<size_t>(chunks));
+        forEachChunkParallel(n, chunks, [&](int c, int from, int to)
+        {
+            const QJsonArray chunkArray(array); // own copy, only reentrant
+            AircraftIcaoIdMap chunkAircraftIcaos(aircraftIcaosMap);
+            LiveryIdMap chunkLiveries(liveriesMap);
+            DistributorIdMap chunkDistributors(distributorsMap);
+            CAircraftModelList &models = chunkModels[static_cast<size_t>(c)];
+            models.reserve(to - from);
+            for (int i = from; i < to; ++i)
+            {
+                models.push_back(CAircraftModel::fromDatabaseJsonCaching(chunkArray.at(i).toObject(), chunkAircraftIcaos, categoriesMap, chunkLiveries, chunkDistributors));
+            }
+        }, progress);
+
+        if (chunkModels.size() == 1) { return std::move(chunkModels.front()); }
         CAircraftModelList models;
-        for (const QJsonValue &value : array)
-        {
-            models.push_back(CAircraftModel::fromDatabaseJsonCaching(value.toObject(), aircraftIcaosMap, categoriesMap, liveriesMap, distributorsMap));
-        }
+        models.reserve(n);
+        for (CAircraftModelList &chunk : chunkModels) { models.push_back(std::move(chunk)); }
         return models;
     }
 
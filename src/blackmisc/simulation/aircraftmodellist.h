@@ -36,6 +36,7 @@
 #include <QHash>
 #include <QMap>
 #include <atomic>
+#include <functional>
 
 BLACK_DECLARE_SEQUENCE_MIXINS(BlackMisc::Simulation, CAircraftModel, CAircraftModelList)
 
@@ -506,6 +507,11 @@ namespace BlackMisc
             //! Score by aircraft ICAO code
             ScoredModels scoreFull(const CAircraftModel &remoteModel, bool preferColorLiveries, bool ignoreZeroScores = true, CStatusMessageList *log = nullptr) const;
 
+            //! Models with the best score by aircraft ICAO code, same as the highest scored models of scoreFull
+            //! \remark no log, scores are calculated in parallel for large lists and only the best models are copied
+            //! \param scoredModels if not null, number of scored models (those scoreFull would return)
+            ScoredModels scoreBest(const CAircraftModel &remoteModel, bool preferColorLiveries, bool ignoreZeroScores = true, int *scoredModels = nullptr) const;
+
             //! Completer strings
             QStringList toCompleterStrings(bool sorted = true, const CSimulatorInfo &simulator = { CSimulatorInfo::All }) const;
 
@@ -522,6 +528,7 @@ namespace BlackMisc
             CStatusMessageList validateFiles(CAircraftModelList &validModels, CAircraftModelList &invalidModels, bool ignoreEmptyFileNames, int stopAtFailedFiles, std::atomic_bool &wasStopped, const QString &simRootDirectory, bool alreadySortedByFn = false) const;
 
             //! To compact JSON format
+            //! \remark large lists are memoized in parallel chunks, the result is the same
             QJsonObject toMemoizedJson() const;
 
             //! From compact JSON format
@@ -561,11 +568,14 @@ namespace BlackMisc
             //! @}
 
             //! Newer version
+            //! \remark ICAO codes, liveries and distributors are taken from the given lists by DB key, not parsed again
+            //! \remark large arrays are converted in parallel chunks, progress is called with the number of converted models
             static CAircraftModelList fromDatabaseJsonCaching(const QJsonArray &array,
                     const Aviation::CAircraftIcaoCodeList &aircraftIcaos = {},
                     const Aviation::CAircraftCategoryList &aircraftCategories = {},
                     const Aviation::CLiveryList &liveries = {},
-                    const CDistributorList &distributors = {});
+                    const CDistributorList &distributors = {},
+                    const std::function<void(int)> &progress = {});
 
         private:
             //! Validate UNC paths (Windows)
@@ -0,0 +1,399 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/simulation/aircraftmodellistbinary.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/units.h"
+#include "blackmisc/memotable.h"
+#include "blackmisc/logcategories.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QHash>
+#include <QIODevice>
+#include <cstring>
+#include <type_traits>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Simulation
+{
+    //! \private File header
+    struct CAircraftModelListBinary::Header
+    {
+        quint32 magic;
+        quint32 version;
+        quint32 headerSize;
+        quint32 recordSize;
+        qint32 modelCount;
+        quint32 stringCount;
+        qint32 dataStreamVersion;
+        quint32 reserved;
+        quint64 recordsOffset;    //!< fixed-width model records
+        quint64 stringsOffset;    //!< offset and length of each string in the string data
+        quint64 stringDataOffset; //!< UTF-16 string data
+        quint64 stringDataSize;
+        quint64 tablesOffset;     //!< object tables marshalled by QDataStream
+        quint64 totalSize;
+        char checksum[16];        //!< MD5 of all data following the header
+    };
+
+    //! \private Fixed-width model record
+    struct CAircraftModelListBinary::Record
+    {
+        qint64 timestamp;
+        qint64 fileTimestamp;
+        double cg;
+        qint32 dbKey;
+        qint32 order;
+        qint32 simulator;
+        qint32 aircraftIcao; //!< index in the aircraft ICAO table
+        qint32 livery;       //!< index in the livery table
+        qint32 distributor;  //!< index in the distributor table
+        qint32 callsign;     //!< index in the callsign table
+        quint32 strings[RecordStringCount]; //!< indexes in the string table
+        qint8 modelType;
+        qint8 modelMode;
+        quint8 cgUnit;       //!< index in CLengthUnit::allUnits
+        quint8 reserved[5];
+    };
+
+    namespace
+    {
+        //! \private Magic number, also detects data of a different byte order
+        constexpr quint32 Magic = 0x4c4d5753; // "SWML" on little endian
+
+        //! \private Increase whenever Header, Record or the object tables change
+        constexpr quint32 Version = 1;
+
+        //! \private Alignment of the sections
+        constexpr int Alignment = 8;
+
+        //! \private Offset and length of a string
+        struct StringEntry
+        {
+            quint32 offset; //!< in UTF-16 code units
+            quint32 length; //!< in UTF-16 code units
+        };
+
+        //! \private Pad to alignment
+        void pad(QByteArray &data)
+        {
+            const int remainder = data.size() % Alignment;
+            if (remainder) { data.append(Alignment - remainder, '\0'); }
+        }
+
+        //! \private Append the bytes of trivially copyable values
+        template <typename T>
+        void appendRaw(QByteArray &data, const T *values, int count)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Raw data only");
+            data.append(reinterpret_cast<const char *>(values), static_cast<int>(sizeof(T)) * count);
+        }
+
+        //! \private Checksum
+        QByteArray checksum(const char *data, qint64 size)
+        {
+            return QCryptographicHash::hash(QByteArray::fromRawData(data, static_cast<int>(size)), QCryptographicHash::Md5);
+        }
+    }
+
+    const QStringList &CAircraftModelListBinary::getLogCategories()
+    {
+        static const QStringList cats { CLogCategories::cache() };
+        return cats;
+    }
+
+    CAircraftModelListBinary::CAircraftModelListBinary() = default;
+
+    CAircraftModelListBinary::CAircraftModelListBinary(const QByteArray &data) : m_data(data)
+    { }
+
+    CAircraftModelListBinary::~CAircraftModelListBinary() = default;
+
+    CStatusMessage CAircraftModelListBinary::mapFile(const QString &fileName)
+    {
+        m_data.clear();
+        m_file = std::make_unique<QFile>(fileName);
+        if (!m_file->open(QIODevice::ReadOnly))
+        {
+            return CStatusMessage(this).error(u"Failed to open %1: %2") << fileName << m_file->errorString();
+        }
+        const qint64 size = m_file->size();
+        const uchar *mapped = size > 0 ? m_file->map(0, size) : nullptr;
+        m_data = mapped ? QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), static_cast<int>(size)) : m_file->readAll();
+        return this->validate();
+    }
+
+    CStatusMessage CAircraftModelListBinary::validate()
+    {
+        m_valid = false;
+        m_tablesLoaded = false;
+        m_count = 0;
+        if (m_data.size() < static_cast<int>(sizeof(Header)))
+        {
+            return CStatusMessage(this).error(u"Binary model data too short, %1 bytes") << m_data.size();
+        }
+
+        Header header;
+        std::memcpy(&header, m_data.constData(), sizeof(Header));
+        if (header.magic != Magic)
+        {
+            return CStatusMessage(this).error(u"No binary model data");
+        }
+        if (header.version != Version || header.headerSize != sizeof(Header) || header.recordSize != sizeof(Record))
+        {
+            return CStatusMessage(this).error(u"Unsupported binary model data version %1") << header.version;
+        }
+
+        const quint64 size = static_cast<quint64>(m_data.size());
+        const quint64 count = header.modelCount < 0 ? 0 : static_cast<quint64>(header.modelCount);
+        const bool layout = header.modelCount >= 0 && header.totalSize == size &&
+                            header.recordsOffset == sizeof(Header) &&
+                            header.recordsOffset + count * sizeof(Record) <= header.stringsOffset &&
+                            header.stringsOffset + header.stringCount * sizeof(StringEntry) <= header.stringDataOffset &&
+                            header.stringDataOffset % Alignment == 0 &&
+                            header.stringDataOffset + header.stringDataSize <= header.tablesOffset &&
+                            header.tablesOffset <= size;
+        if (!layout)
+        {
+            return CStatusMessage(this).error(u"Inconsistent binary model data layout");
+        }
+
+        const QByteArray sum = checksum(m_data.constData() + sizeof(Header), m_data.size() - static_cast<int>(sizeof(Header)));
+        if (sum != QByteArray::fromRawData(header.checksum, sizeof(header.checksum)))
+        {
+            return CStatusMessage(this).error(u"Checksum mismatch in binary model data");
+        }
+
+        m_count = header.modelCount;
+        m_stringCount = header.stringCount;
+        m_recordsOffset = static_cast<qint64>(header.recordsOffset);
+        m_stringsOffset = static_cast<qint64>(header.stringsOffset);
+        m_stringDataOffset = static_cast<qint64>(header.stringDataOffset);
+        m_stringDataSize = static_cast<qint64>(header.stringDataSize);
+        m_tablesOffset = static_cast<qint64>(header.tablesOffset);
+        m_dataStreamVersion = header.dataStreamVersion;
+        m_valid = true;
+        return CStatusMessage(this).info(u"Binary model data with %1 models") << m_count;
+    }
+
+    QString CAircraftModelListBinary::getModelString(int index) const
+    {
+        if (!m_valid || index < 0 || index >= m_count) { return {}; }
+        return this->stringAt(this->recordAt(index).strings[ModelString]);
+    }
+
+    CAircraftModel CAircraftModelListBinary::getModel(int index) const
+    {
+        if (!m_valid || index < 0 || index >= m_count) { return {}; }
+        this->loadTables();
+        return this->toModel(this->recordAt(index), nullptr);
+    }
+
+    CAircraftModelList CAircraftModelListBinary::toAircraftModelList() const
+    {
+        if (!m_valid) { return {}; }
+        this->loadTables();
+
+        // convert every distinct string once, the models share them
+        QVector<QString> strings;
+        strings.reserve(static_cast<int>(m_stringCount));
+        for (quint32 i = 0; i < m_stringCount; ++i) { strings.push_back(this->stringAt(i)); }
+
+        CAircraftModelList models;
+        models.reserve(m_count);
+        for (int i = 0; i < m_count; ++i)
+        {
+            models.push_back(this->toModel(this->recordAt(i), &strings));
+        }
+        return models;
+    }
+
+    QByteArray CAircraftModelListBinary::toBinary(const CAircraftModelList &models)
+    {
+        static_assert(std::is_trivially_copyable_v<Header> && std::is_trivially_copyable_v<Record>, "Copied as plain memory");
+        static_assert(sizeof(Header) % Alignment == 0 && sizeof(Record) % Alignment == 0, "Aligned sections");
+
+        CAircraftModel::MemoHelper::CMemoizer memo;
+        CMemoTable<CCallsign> callsigns;
+
+        QHash<QString, quint32> stringIndexes;
+        QVector<QString> strings { QString() }; // index 0 is the empty string
+        const auto stringIndex = [&](const QString &string) -> quint32
+        {
+            if (string.isEmpty()) { return 0; }
+            auto it = stringIndexes.constFind(string);
+            if (it != stringIndexes.constEnd()) { return *it; }
+            const quint32 index = static_cast<quint32>(strings.size());
+            stringIndexes.insert(string, index);
+            strings.push_back(string);
+            return index;
+        };
+
+        QVector<Record> records;
+        records.reserve(models.sizeInt());
+        for (const CAircraftModel &model : models)
+        {
+            Record record {};
+            record.timestamp = model.getMSecsSinceEpoch();
+            record.fileTimestamp = model.m_fileTimestamp;
+            record.dbKey = model.getDbKey();
+            record.order = model.getOrder();
+            record.simulator = static_cast<qint32>(model.m_simulator.getSimulator());
+            record.aircraftIcao = memo.maybeMemoize(model.m_aircraftIcao);
+            record.livery = memo.maybeMemoize(model.m_livery);
+            record.distributor = memo.maybeMemoize(model.m_distributor);
+            record.callsign = callsigns.getIndex(model.m_callsign);
+            record.strings[ModelString] = stringIndex(model.m_modelString);
+            record.strings[ModelStringAlias] = stringIndex(model.m_modelStringAlias);
+            record.strings[Name] = stringIndex(model.m_name);
+            record.strings[Description] = stringIndex(model.m_description);
+            record.strings[FileName] = stringIndex(model.m_fileName);
+            record.strings[IconFile] = stringIndex(model.m_iconFile);
+            record.strings[SupportedParts] = stringIndex(model.m_supportedParts);
+            record.modelType = static_cast<qint8>(model.m_modelType);
+            record.modelMode = static_cast<qint8>(model.m_modelMode);
+
+            const int unit = CLengthUnit::allUnits().indexOf(model.m_cg.getUnit());
+            record.cg = unit >= 0 ? model.m_cg.value() : model.m_cg.value(CLengthUnit::defaultUnit());
+            record.cgUnit = static_cast<quint8>(unit >= 0 ? unit : CLengthUnit::allUnits().indexOf(CLengthUnit::defaultUnit()));
+            records.push_back(record);
+        }
+
+        Header header {};
+        header.magic = Magic;
+        header.version = Version;
+        header.headerSize = sizeof(Header);
+        header.recordSize = sizeof(Record);
+        header.modelCount = records.size();
+        header.stringCount = static_cast<quint32>(strings.size());
+
+        QByteArray data(sizeof(Header), '\0');
+        header.recordsOffset = static_cast<quint64>(data.size());
+        appendRaw(data, records.constData(), records.size());
+        pad(data);
+
+        QVector<StringEntry> entries;
+        entries.reserve(strings.size());
+        quint32 offset = 0;
+        for (const QString &string : std::as_const(strings))
+        {
+            entries.push_back({ offset, static_cast<quint32>(string.size()) });
+            offset += static_cast<quint32>(string.size());
+        }
+        header.stringsOffset = static_cast<quint64>(data.size());
+        appendRaw(data, entries.constData(), entries.size());
+        pad(data);
+
+        header.stringDataOffset = static_cast<quint64>(data.size());
+        for (const QString &string : std::as_const(strings)) { appendRaw(data, string.utf16(), string.size()); }
+        header.stringDataSize = static_cast<quint64>(data.size()) - header.stringDataOffset;
+        pad(data);
+
+        QByteArray tables;
+        {
+            QDataStream stream(&tables, QIODevice::WriteOnly);
+            header.dataStreamVersion = stream.version();
+            stream << memo.getTable<CAircraftIcaoCode>() << memo.getTable<CLivery>() << memo.getTable<CDistributor>() << callsigns.getTable();
+        }
+        header.tablesOffset = static_cast<quint64>(data.size());
+        data.append(tables);
+        header.totalSize = static_cast<quint64>(data.size());
+
+        const QByteArray sum = checksum(data.constData() + sizeof(Header), data.size() - static_cast<int>(sizeof(Header)));
+        std::memcpy(header.checksum, sum.constData(), sizeof(header.checksum));
+        std::memcpy(data.data(), &header, sizeof(Header));
+        return data;
+    }
+
+    bool CAircraftModelListBinary::isBinary(const QByteArray &data)
+    {
+        if (data.size() < static_cast<int>(sizeof(quint32))) { return false; }
+        quint32 magic = 0;
+        std::memcpy(&magic, data.constData(), sizeof(magic));
+        return magic == Magic;
+    }
+
+    CAircraftModelList CAircraftModelListBinary::fromBinary(const QByteArray &data, CStatusMessage &o_status)
+    {
+        CAircraftModelListBinary binary(data);
+        o_status = binary.validate();
+        return binary.toAircraftModelList();
+    }
+
+    CAircraftModelList CAircraftModelListBinary::fromFile(const QString &fileName, CStatusMessage &o_status)
+    {
+        CAircraftModelListBinary binary;
+        o_status = binary.mapFile(fileName);
+        return binary.toAircraftModelList();
+    }
+
+    CAircraftModelListBinary::Record CAircraftModelListBinary::recordAt(int index) const
+    {
+        Record record;
+        std::memcpy(&record, m_data.constData() + m_recordsOffset + static_cast<qint64>(index) * static_cast<qint64>(sizeof(Record)), sizeof(Record));
+        return record;
+    }
+
+    QString CAircraftModelListBinary::stringAt(quint32 index) const
+    {
+        if (index == 0 || index >= m_stringCount) { return {}; }
+        StringEntry entry;
+        std::memcpy(&entry, m_data.constData() + m_stringsOffset + static_cast<qint64>(index) * static_cast<qint64>(sizeof(StringEntry)), sizeof(StringEntry));
+        if ((static_cast<qint64>(entry.offset) + entry.length) * 2 > m_stringDataSize) { return {}; }
+        const char *string = m_data.constData() + m_stringDataOffset + static_cast<qint64>(entry.offset) * 2;
+        return QString(reinterpret_cast<const QChar *>(string), static_cast<int>(entry.length));
+    }
+
+    void CAircraftModelListBinary::loadTables() const
+    {
+        if (m_tablesLoaded) { return; }
+        m_tablesLoaded = true;
+
+        const QByteArray tables = QByteArray::fromRawData(m_data.constData() + m_tablesOffset, m_data.size() - static_cast<int>(m_tablesOffset));
+        QDataStream stream(tables);
+        stream.setVersion(m_dataStreamVersion);
+        stream >> m_aircraftIcaos >> m_liveries >> m_distributors >> m_callsigns;
+    }
+
+    CAircraftModel CAircraftModelListBinary::toModel(const Record &record, const QVector<QString> *strings) const
+    {
+        const auto string = [&](RecordString s)
+        {
+            const quint32 index = record.strings[s];
+            if (!strings) { return this->stringAt(index); }
+            return index < static_cast<quint32>(strings->size()) ? strings->at(static_cast<int>(index)) : QString();
+        };
+
+        CAircraftModel model;
+        model.setMSecsSinceEpoch(record.timestamp);
+        model.setDbKey(record.dbKey);
+        model.setOrder(record.order);
+        model.m_fileTimestamp = record.fileTimestamp;
+        model.m_simulator = CSimulatorInfo(record.simulator);
+        if (record.aircraftIcao >= 0 && record.aircraftIcao < m_aircraftIcaos.size()) { model.m_aircraftIcao = m_aircraftIcaos[record.aircraftIcao]; }
+        if (record.livery >= 0 && record.livery < m_liveries.size()) { model.m_livery = m_liveries[record.livery]; }
+        if (record.distributor >= 0 && record.distributor < m_distributors.size()) { model.m_distributor = m_distributors[record.distributor]; }
+        if (record.callsign >= 0 && record.callsign < m_callsigns.size()) { model.m_callsign = m_callsigns[record.callsign]; }
+        model.m_modelString = string(ModelString);
+        model.m_modelStringAlias = string(ModelStringAlias);
+        model.m_name = string(Name);
+        model.m_description = string(Description);
+        model.m_fileName = string(FileName);
+        model.m_iconFile = string(IconFile);
+        model.m_supportedParts = string(SupportedParts);
+        model.m_modelType = static_cast<CAircraftModel::ModelType>(record.modelType);
+        model.m_modelMode = static_cast<CAircraftModel::ModelMode>(record.modelMode);
+
+        const QList<CLengthUnit> &units = CLengthUnit::allUnits();
+        model.m_cg = CLength(record.cg, record.cgUnit < units.size() ? units.at(record.cgUnit) : CLengthUnit::nullUnit());
+        return model;
+    }
+} // ns
@@ -0,0 +1,148 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_SIMULATION_AIRCRAFTMODELLISTBINARY_H
+#define BLACKMISC_SIMULATION_AIRCRAFTMODELLISTBINARY_H
+
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/aircraftmodel.h"
+#include "blackmisc/simulation/distributor.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/aviation/livery.h"
+#include "blackmisc/sequence.h"
+#include "blackmisc/statusmessage.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+#include <QStringList>
+#include <memory>
+
+namespace BlackMisc::Simulation
+{
+    /*!
+     * Versioned binary format of a CAircraftModelList, used to persist the model caches.
+     *
+     * The data consist of a header, one fixed-width record per model, a table of the distinct strings
+     * and tables of the distinct aircraft ICAO codes, liveries, distributors and callsigns, followed by
+     * a checksum of all of it. Single models and model strings can be read without converting the whole list.
+     * \remark the data caches convert the whole list when they load a value
+     * \remark the data use the native byte order and are meant for local caches, JSON is used for import and export
+     * \remark object tables are loaded on first access, so a const object is not threadsafe
+     */
+    class BLACKMISC_EXPORT CAircraftModelListBinary
+    {
+    public:
+        //! Log categories
+        static const QStringList &getLogCategories();
+
+        //! Default constructor, no data
+        CAircraftModelListBinary();
+
+        //! Binary data, not copied when created by QByteArray::fromRawData
+        //! \remark call validate before accessing the models
+        explicit CAircraftModelListBinary(const QByteArray &data);
+
+        //! Destructor, unmaps a mapped file
+        ~CAircraftModelListBinary();
+
+        //! Not copyable
+        //! @{
+        CAircraftModelListBinary(const CAircraftModelListBinary &) = delete;
+        CAircraftModelListBinary &operator =(const CAircraftModelListBinary &) = delete;
+        //! @}
+
+        //! Memory map a file and validate it
+        //! \remark if the file can not be mapped it is read
+        CStatusMessage mapFile(const QString &fileName);
+
+        //! Validate the header and the checksum
+        CStatusMessage validate();
+
+        //! Validated data?
+        bool isValid() const { return m_valid; }
+
+        //! Number of models
+        int size() const { return m_count; }
+
+        //! Model string of the model at index, without materializing the model
+        QString getModelString(int index) const;
+
+        //! Model at index
+        CAircraftModel getModel(int index) const;
+
+        //! All models
+        CAircraftModelList toAircraftModelList() const;
+
+        //! Binary data of models
+        static QByteArray toBinary(const CAircraftModelList &models);
+
+        //! Do the data start like binary model data?
+        //! \remark only checks the magic number, use validate to check the data
+        static bool isBinary(const QByteArray &data);
+
+        //! Models of binary data
+        static CAircraftModelList fromBinary(const QByteArray &data, CStatusMessage &o_status);
+
+        //! Read models from a binary file
+        static CAircraftModelList fromFile(const QString &fileName, CStatusMessage &o_status);
+
+    private:
+        struct Header;
+        struct Record;
+
+        //! Strings of a record
+        enum RecordString
+        {
+            ModelString,
+            ModelStringAlias,
+            Name,
+            Description,
+            FileName,
+            IconFile,
+            SupportedParts,
+            RecordStringCount
+        };
+
+        //! Record at index
+        Record recordAt(int index) const;
+
+        //! String at index of the string table
+        QString stringAt(quint32 index) const;
+
+        //! Unmarshal the object tables if not yet done
+        void loadTables() const;
+
+        //! Model of record, with strings from the string table or the already converted strings
+        CAircraftModel toModel(const Record &record, const QVector<QString> *strings) const;
+
+        std::unique_ptr<QFile> m_file; //!< mapped file, destroyed after m_data
+        QByteArray m_data;
+        bool m_valid = false;
+        int m_count = 0;
+        quint32 m_stringCount = 0;
+        qint64 m_recordsOffset = 0;
+        qint64 m_stringsOffset = 0;
+        qint64 m_stringDataOffset = 0;
+        qint64 m_stringDataSize = 0;
+        qint64 m_tablesOffset = 0;
+        int m_dataStreamVersion = 0;
+
+        mutable bool m_tablesLoaded = false;
+        mutable CSequence<Aviation::CAircraftIcaoCode> m_aircraftIcaos;
+        mutable CSequence<Aviation::CLivery> m_liveries;
+        mutable CSequence<CDistributor> m_distributors;
+        mutable CSequence<Aviation::CCallsign> m_callsigns;
+    };
+} // namespace
+
+#endif // guard
@@ -0,0 +1,141 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/simulation/aircraftmodelsetindex.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/airlineicaocode.h"
+#include "blackmisc/aviation/livery.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+using namespace BlackMisc::Aviation;
+
+namespace BlackMisc::Simulation
+{
+    CAircraftModelSetIndex::CAircraftModelSetIndex(const CAircraftModelList &models) : m_models(models)
+    {
+        int p = 0;
+        for (const CAircraftModel &model : m_models)
+        {
+            const CAircraftIcaoCode &aircraftIcao = model.getAircraftIcaoCode();
+            if (model.hasModelString()) { m_byModelString[model.getModelString().toUpper()].push_back(p); }
+            if (!model.getModelStringAlias().isEmpty())
+            {
+                Positions &aliasPositions = m_byModelString[model.getModelStringAlias().toUpper()];
+                if (aliasPositions.isEmpty() || aliasPositions.last() != p) { aliasPositions.push_back(p); }
+            }
+            m_byAircraftDesignator[aircraftIcao.getDesignator()].push_back(p);
+            m_byAirlineDesignator[model.getAirlineIcaoCode().getDesignator()].push_back(p);
+            if (aircraftIcao.hasFamily()) { m_byFamily[aircraftIcao.getFamily()].push_back(p); }
+            m_byManufacturer[aircraftIcao.getManufacturer()].push_back(p);
+            m_byCombinedType[aircraftIcao.getCombinedType()].push_back(p);
+            if (model.getLivery().hasCombinedCode()) { m_byLiveryCombinedCode[model.getLivery().getCombinedCode()].push_back(p); }
+            p++;
+        }
+    }
+
+    bool CAircraftModelSetIndex::isIndexOf(const CAircraftModelList &models) const
+    {
+        if (models.size() != m_models.size()) { return false; }
+        if (models.isEmpty()) { return true; }
+        return &*models.cbegin() == &*m_models.cbegin();
+    }
+
+    CAircraftModelList CAircraftModelSetIndex::models(const Positions &positions) const
+    {
+        QVector<CAircraftModel> models;
+        models.reserve(positions.size());
+        for (int p : positions) { models.push_back(m_models[p]); }
+        return CSequence<CAircraftModel>(std::move(models));
+    }
+
+    CAircraftModelSetIndex::Positions CAircraftModelSetIndex::intersect(const Positions &p1, const Positions &p2)
+    {
+        Positions result;
+        result.reserve(qMin(p1.size(), p2.size()));
+        std::set_intersection(p1.cbegin(), p1.cend(), p2.cbegin(), p2.cend(), std::back_inserter(result));
+        return result;
+    }
+
+    CAircraftModel CAircraftModelSetIndex::findFirstByModelStringAliasOrDefault(const QString &modelString) const
+    {
+        if (modelString.isEmpty()) { return CAircraftModel(); }
+        const auto it = m_byModelString.constFind(modelString.toUpper());
+        if (it == m_byModelString.constEnd() || it->isEmpty()) { return CAircraftModel(); }
+        return m_models[it->first()];
+    }
+
+    CAircraftModelList CAircraftModelSetIndex::findByIcaoDesignators(const CAircraftIcaoCode &aircraftIcaoCode, const CAirlineIcaoCode &airlineIcaoCode) const
+    {
+        const QString aircraft(aircraftIcaoCode.getDesignator());
+        const QString airline(airlineIcaoCode.getDesignator());
+        if (airline.isEmpty())  { return this->models(m_byAircraftDesignator.value(aircraft)); }
+        if (aircraft.isEmpty()) { return this->models(m_byAirlineDesignator.value(airline)); }
+        return this->models(intersect(m_byAircraftDesignator.value(aircraft), m_byAirlineDesignator.value(airline)));
+    }
+
+    CAircraftModelList CAircraftModelSetIndex::findByAircraftDesignatorAndLiveryCombinedCode(const QString &aircraftDesignator, const QString &combinedCode) const
+    {
+        if (aircraftDesignator.isEmpty() || combinedCode.isEmpty()) { return CAircraftModelList(); }
+        const Positions byLivery = m_byLiveryCombinedCode.value(combinedCode.trimmed().toUpper());
+        if (byLivery.isEmpty()) { return CAircraftModelList(); }
+        return this->models(intersect(m_byAircraftDesignator.value(aircraftDesignator.trimmed().toUpper()), byLivery));
+    }
+
+    CAircraftModelList CAircraftModelSetIndex::findByFamily(const QString &family) const
+    {
+        if (family.isEmpty()) { return CAircraftModelList(); }
+        return this->models(m_byFamily.value(family.toUpper().trimmed()));
+    }
+
+    CAircraftModelList CAircraftModelSetIndex::findByManufacturer(const QString &manufacturer) const
+    {
+        if (manufacturer.isEmpty()) { return CAircraftModelList(); }
+        return this->models(m_byManufacturer.value(manufacturer.toUpper().trimmed()));
+    }
+
+    CAircraftModelList CAircraftModelSetIndex::findByCombinedType(const QString &combinedType) const
+    {
+        if (combinedType.length() != 3 || combinedType.trimmed().length() != 3) { return CAircraftModelList(); }
+        Positions positions;
+        if (!this->combinedTypePositions(combinedType, positions)) { return m_models.findByCombinedType(combinedType); }
+        return this->models(positions);
+    }
+
+    CAircraftModelList CAircraftModelSetIndex::findByCombinedAndManufacturer(const CAircraftIcaoCode &icao) const
+    {
+        const QString &combinedType = icao.getCombinedType();
+        const QString &manufacturer = icao.getManufacturer();
+        if (manufacturer.isEmpty()) { return this->findByCombinedType(combinedType); }
+        if (combinedType.isEmpty()) { return this->findByManufacturer(manufacturer); }
+
+        Positions positions;
+        if (!this->combinedTypePositions(combinedType, positions)) { return m_models.findByCombinedAndManufacturer(icao); }
+
+        // manufacturer is compared case insensitive, filter the usually small result by combined type
+        CAircraftModelList models;
+        for (int p : std::as_const(positions))
+        {
+            const CAircraftModel &model = m_models[p];
+            if (model.getAircraftIcaoCode().matchesManufacturer(manufacturer)) { models.push_back(model); }
+        }
+        return models;
+    }
+
+    bool CAircraftModelSetIndex::combinedTypePositions(const QString &combinedType, Positions &positions) const
+    {
+        positions.clear();
+        if (combinedType.length() != 3) { return true; }
+        const QString cc(combinedType.toUpper().trimmed().replace(' ', '*').replace('-', '*'));
+        if (cc.contains('*')) { return false; } // wildcards, see CAircraftIcaoCode::matchesCombinedType
+        positions = m_byCombinedType.value(cc);
+        return true;
+    }
+} // ns
@@ -0,0 +1,94 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_SIMULATION_AIRCRAFTMODELSETINDEX_H
+#define BLACKMISC_SIMULATION_AIRCRAFTMODELSETINDEX_H
+
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+namespace BlackMisc::Simulation
+{
+    //! Hash indexes of a model set, built once and used for the matching reduction steps
+    //! \remark Models are referred to by their position in the indexed list. Positions per key are sorted,
+    //!         so results keep the order of the list and combined criteria are sorted intersections.
+    //! \remark The find functions return the same models as the corresponding CAircraftModelList functions
+    //!         called on the indexed list.
+    class BLACKMISC_EXPORT CAircraftModelSetIndex
+    {
+    public:
+        //! Positions in the indexed list, ascending
+        using Positions = QVector<int>;
+
+        //! Default constructor, empty index
+        CAircraftModelSetIndex() = default;
+
+        //! Build index of models
+        explicit CAircraftModelSetIndex(const CAircraftModelList &models);
+
+        //! Indexed models
+        const CAircraftModelList &getModels() const { return m_models; }
+
+        //! Number of indexed models
+        int size() const { return m_models.sizeInt(); }
+
+        //! Is models the (implicitly shared and unmodified) list this index was built from?
+        //! \remark cheap, compares size and data
+        bool isIndexOf(const CAircraftModelList &models) const;
+
+        //! Models at positions
+        CAircraftModelList models(const Positions &positions) const;
+
+        //! Intersection of sorted positions
+        static Positions intersect(const Positions &p1, const Positions &p2);
+
+        //! \copydoc CAircraftModelList::findFirstByModelStringAliasOrDefault
+        //! \remark case insensitive only
+        CAircraftModel findFirstByModelStringAliasOrDefault(const QString &modelString) const;
+
+        //! \copydoc CAircraftModelList::findByIcaoDesignators
+        CAircraftModelList findByIcaoDesignators(const Aviation::CAircraftIcaoCode &aircraftIcaoCode, const Aviation::CAirlineIcaoCode &airlineIcaoCode) const;
+
+        //! \copydoc CAircraftModelList::findByAircraftDesignatorAndLiveryCombinedCode
+        CAircraftModelList findByAircraftDesignatorAndLiveryCombinedCode(const QString &aircraftDesignator, const QString &combinedCode) const;
+
+        //! \copydoc CAircraftModelList::findByFamily
+        CAircraftModelList findByFamily(const QString &family) const;
+
+        //! \copydoc CAircraftModelList::findByManufacturer
+        CAircraftModelList findByManufacturer(const QString &manufacturer) const;
+
+        //! \copydoc CAircraftModelList::findByCombinedType
+        //! \remark wildcard types ("L*J") are not indexed and searched in the list
+        CAircraftModelList findByCombinedType(const QString &combinedType) const;
+
+        //! \copydoc CAircraftModelList::findByCombinedAndManufacturer
+        CAircraftModelList findByCombinedAndManufacturer(const Aviation::CAircraftIcaoCode &icao) const;
+
+    private:
+        //! Positions of combined type, false if it can not be looked up in the index
+        bool combinedTypePositions(const QString &combinedType, Positions &positions) const;
+
+        CAircraftModelList m_models;
+        QHash<QString, Positions> m_byModelString;         //!< model string and alias, upper case
+        QHash<QString, Positions> m_byAircraftDesignator;  //!< aircraft ICAO designator
+        QHash<QString, Positions> m_byAirlineDesignator;   //!< airline ICAO designator
+        QHash<QString, Positions> m_byFamily;              //!< aircraft family
+        QHash<QString, Positions> m_byManufacturer;        //!< aircraft manufacturer
+        QHash<QString, Positions> m_byCombinedType;        //!< combined type such as "L2J"
+        QHash<QString, Positions> m_byLiveryCombinedCode;  //!< livery combined code
+    };
+} // ns
+
+#endif // guard
@@ -11,7 +11,12 @@
 #include "blackmisc/simulation/airspaceaircraftsnapshot.h"
 #include "blackmisc/simulation/simulatedaircraft.h"
 
+#include <QHash>
 #include <QThread>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
 
 using namespace BlackMisc::Aviation;
 using namespace BlackMisc::PhysicalQuantities;
@@ -33,61 +38,110 @@ namespace BlackMisc::Simulation
         m_threadName(QThread::currentThread()->objectName())
     {
         if (allAircraft.isEmpty()) { return; }
+        this->rank(allAircraft, {});
+        this->classify(restricted, maxAircraft, maxRenderedDistance);
+    }
+
+    CAirspaceAircraftSnapshot::CAirspaceAircraftSnapshot(
+        const CSimulatedAircraftList &allAircraft, const CAirspaceAircraftSnapshot &previous,
+        bool restricted, bool renderingEnabled, int maxAircraft,
+        const CLength &maxRenderedDistance) :
+        m_timestampMsSinceEpoch(QDateTime::currentMSecsSinceEpoch()),
+        m_previousTimestampMsSinceEpoch(previous.m_timestampMsSinceEpoch),
+        m_restricted(restricted),
+        m_renderingEnabled(renderingEnabled),
+        m_threadName(QThread::currentThread()->objectName())
+    {
+        if (allAircraft.isEmpty()) { return; }
+        this->rank(allAircraft, previous.m_ranking);
+        this->classify(restricted, maxAircraft, maxRenderedDistance);
+    }
+
+    bool CAirspaceAircraftSnapshot::isRankedBefore(const RankedAircraft &a, const RankedAircraft &b)
+    {
+        // same order as CSimulatedAircraftList::sortByDistanceToReferencePositionRenderedCallsign
+        if (a.distanceM != b.distanceM) { return a.distanceM < b.distanceM; }
+        if (a.rendered != b.rendered) { return a.rendered; } // get the rendered first
+        return a.callsign.asString() < b.callsign.asString();
+    }
 
-        CSimulatedAircraftList aircraft(allAircraft);
-        aircraft.sortByDistanceToReferencePositionRenderedCallsign();
-        const int numberAll = aircraft.size();
-        Q_ASSERT_X(numberAll == allAircraft.size(), Q_FUNC_INFO, "aircraft got lost");
-        const CSimulatedAircraftList vtolAircraft(aircraft.findByVtol(true));
-        const int numberVtol = vtolAircraft.size();
-        m_aircraftCallsignsByDistance = aircraft.getCallsigns();
-        Q_ASSERT_X(m_aircraftCallsignsByDistance.size() == allAircraft.size(), Q_FUNC_INFO, "redundant or missing callsigns");
-        m_vtolAircraftCallsignsByDistance = vtolAircraft.getCallsigns();
-        Q_ASSERT_X(m_vtolAircraftCallsignsByDistance.size() == numberVtol, Q_FUNC_INFO, "redundant or missing callsigns");
-
-        // no restrictions, just find by attributes
-        if (!restricted)
+    void CAirspaceAircraftSnapshot::rank(const CSimulatedAircraftList &allAircraft, const QVector<RankedAircraft> &previousRanking)
+    {
+        QVector<RankedAircraft> current;
+        QHash<CCallsign, int> positions;
+        current.reserve(allAircraft.size());
+        positions.reserve(allAircraft.size());
+        for (const CSimulatedAircraft &aircraft : allAircraft)
         {
-            m_enabledAircraftCallsignsByDistance = aircraft.findByEnabled(true).getCallsigns();
-            m_disabledAircraftCallsignsByDistance = aircraft.findByEnabled(false).getCallsigns();
-            int numberEnabled = m_enabledAircraftCallsignsByDistance.size();
-            int numberDisabled = m_disabledAircraftCallsignsByDistance.size();
-            Q_ASSERT_X(numberEnabled + numberDisabled == numberAll, Q_FUNC_INFO, "Mismatch in enabled/disabled/all");
-            m_enabledVtolAircraftCallsignsByDistance = vtolAircraft.findByEnabled(true).getCallsigns();
-            return;
+            RankedAircraft ranked;
+            ranked.callsign = aircraft.getCallsign();
+            ranked.distanceM = aircraft.getRelativeDistance().isNull() ? std::numeric_limits<double>::infinity() : aircraft.getRelativeDistance().value(CLengthUnit::m());
+            ranked.rendered = aircraft.isRendered();
+            ranked.enabled = aircraft.isEnabled();
+            ranked.vtol = aircraft.isVtol();
+            positions.insert(ranked.callsign, current.size());
+            current.push_back(ranked);
         }
 
-        // no rendering, this means all aircraft are disabled
-        if (!m_renderingEnabled)
+        // aircraft in previous order, an aircraft stays in place if it is still between its neighbours,
+        // the others (moved or new) are sorted and merged
+        QVector<int> previousOrder;
+        QVector<bool> inPreviousOrder(current.size(), false);
+        previousOrder.reserve(current.size());
+        for (const RankedAircraft &ranked : previousRanking)
+        {
+            const int p = positions.value(ranked.callsign, -1);
+            if (p < 0 || inPreviousOrder[p]) { continue; }
+            inPreviousOrder[p] = true;
+            previousOrder.push_back(p);
+        }
+
+        QVector<RankedAircraft> kept;
+        QVector<RankedAircraft> moved;
+        kept.reserve(previousOrder.size());
+        for (int i = 0; i < previousOrder.size(); ++i)
+        {
+            const RankedAircraft &ranked = current[previousOrder[i]];
+            const bool afterLast = kept.isEmpty() || !isRankedBefore(ranked, kept.back());
+            const bool beforeNext = i + 1 >= previousOrder.size() || !isRankedBefore(current[previousOrder[i + 1]], ranked);
+            if (afterLast && beforeNext) { kept.push_back(ranked); }
+            else { moved.push_back(ranked); }
+        }
+        for (int p = 0; p < current.size(); ++p)
         {
-            m_disabledAircraftCallsignsByDistance = aircraft.getCallsigns();
-            return;
+            if (!inPreviousOrder[p]) { moved.push_back(current[p]); }
         }
 
-        // restricted
+        std::sort(moved.begin(), moved.end(), &CAirspaceAircraftSnapshot::isRankedBefore);
+        m_ranking.clear();
+        m_ranking.reserve(current.size());
+        std::merge(kept.cbegin(), kept.cend(), moved.cbegin(), moved.cend(), std::back_inserter(m_ranking), &CAirspaceAircraftSnapshot::isRankedBefore);
+        m_reRankedCount = moved.size();
+    }
+
+    void CAirspaceAircraftSnapshot::classify(bool restricted, int maxAircraft, const CLength &maxRenderedDistance)
+    {
+        const double maxDistanceM = maxRenderedDistance.isNull() ? std::numeric_limits<double>::infinity() : maxRenderedDistance.value(CLengthUnit::m());
         int count = 0; // when max. aircraft reached?
-        for (const CSimulatedAircraft &currentAircraft : aircraft)
+        for (const RankedAircraft &ranked : std::as_const(m_ranking))
         {
-            const CCallsign cs(currentAircraft.getCallsign());
-            if (currentAircraft.isEnabled())
-            {
-                CLength distance(currentAircraft.getRelativeDistance());
-                if (count >= maxAircraft || (!maxRenderedDistance.isNull() && distance >= maxRenderedDistance))
-                {
-                    m_disabledAircraftCallsignsByDistance.push_back(cs);
-                }
-                else
-                {
-                    count++;
-                    m_enabledAircraftCallsignsByDistance.push_back(cs);
-                    if (currentAircraft.isVtol()) { m_enabledVtolAircraftCallsignsByDistance.push_back(cs); }
-                }
-            }
-            else
+            m_aircraftCallsignsByDistance.push_back(ranked.callsign);
+            if (ranked.vtol) { m_vtolAircraftCallsignsByDistance.push_back(ranked.callsign); }
+
+            bool enabled = ranked.enabled;
+            if (restricted)
             {
-                m_disabledAircraftCallsignsByDistance.push_back(cs);
+                // no rendering, this means all aircraft are disabled
+                if (!m_renderingEnabled) { enabled = false; }
+                else if (enabled && (count >= maxAircraft || (!maxRenderedDistance.isNull() && ranked.distanceM >= maxDistanceM))) { enabled = false; }
+                else if (enabled) { count++; }
             }
+
+            if (!enabled) { m_disabledAircraftCallsignsByDistance.push_back(ranked.callsign); continue; }
+            m_enabledAircraftCallsignsByDistance.push_back(ranked.callsign);
+            if (ranked.vtol) { m_enabledVtolAircraftCallsignsByDistance.push_back(ranked.callsign); }
         }
+        Q_ASSERT_X(m_enabledAircraftCallsignsByDistance.size() + m_disabledAircraftCallsignsByDistance.size() == m_aircraftCallsignsByDistance.size(), Q_FUNC_INFO, "Mismatch in enabled/disabled/all");
     }
 
     bool CAirspaceAircraftSnapshot::isValidSnapshot() const
@@ -23,6 +23,7 @@
 #include <QDateTime>
 #include <QMetaType>
 #include <QString>
+#include <QVector>
 #include <QtGlobal>
 
 BLACK_DECLARE_VALUEOBJECT_MIXINS(BlackMisc::Simulation, CAirspaceAircraftSnapshot)
@@ -43,9 +44,19 @@ namespace BlackMisc::Simulation
                                     int maxAircraft       = 100,
                                     const BlackMisc::PhysicalQuantities::CLength &maxRenderedDistance = { 0, nullptr });
 
+        //! Constructor, incrementally from the previous snapshot
+        //! \remark only aircraft whose distance changed their order are ranked again
+        CAirspaceAircraftSnapshot(const CSimulatedAircraftList &allAircraft,
+                                    const CAirspaceAircraftSnapshot &previous,
+                                    bool restricted, bool renderingEnabled, int maxAircraft,
+                                    const BlackMisc::PhysicalQuantities::CLength &maxRenderedDistance);
+
         //! Time when snapshot was taken
         const QDateTime getTimestamp() const { return QDateTime::fromMSecsSinceEpoch(m_timestampMsSinceEpoch); }
 
+        //! Time when snapshot was taken
+        qint64 getMSecsSinceEpoch() const { return m_timestampMsSinceEpoch; }
+
         //! Callsigns by distance
         const BlackMisc::Aviation::CCallsignSet &getAircraftCallsignsByDistance() const { return m_aircraftCallsignsByDistance; }
 
@@ -61,6 +72,15 @@ namespace BlackMisc::Simulation
         //! VTOL aircraft callsigns by distance, only enabled aircraft
         const BlackMisc::Aviation::CCallsignSet &getEnabledVtolAircraftCallsignsByDistance() const { return m_enabledVtolAircraftCallsignsByDistance; }
 
+        //! Built incrementally from a previous snapshot?
+        bool isIncremental() const { return m_previousTimestampMsSinceEpoch > 0; }
+
+        //! Time of the previous snapshot, -1 if not incremental
+        qint64 getPreviousMSecsSinceEpoch() const { return m_previousTimestampMsSinceEpoch; }
+
+        //! Number of aircraft ranked again, all aircraft if not incremental
+        int getReRankedAircraftCount() const { return m_reRankedCount; }
+
         //! Valid snapshot?
         bool isValidSnapshot() const;
 
@@ -92,13 +112,34 @@ namespace BlackMisc::Simulation
         const QString &generatingThreadName() const { return m_threadName; }
 
     private:
+        //! Aircraft ranked by distance
+        struct RankedAircraft
+        {
+            BlackMisc::Aviation::CCallsign callsign; //!< callsign
+            double distanceM = 0.0;                  //!< relative distance, infinity if unknown
+            bool rendered = false;                   //!< rendered aircraft first if same distance
+            bool enabled = false;                    //!< enabled
+            bool vtol = false;                       //!< VTOL
+        };
+
+        //! Is a ranked before b?
+        static bool isRankedBefore(const RankedAircraft &a, const RankedAircraft &b);
+
+        //! Rank all aircraft, previous order is kept where still valid
+        void rank(const CSimulatedAircraftList &allAircraft, const QVector<RankedAircraft> &previousRanking);
+
+        //! Sort ranked aircraft into the callsign sets
+        void classify(bool restricted, int maxAircraft, const BlackMisc::PhysicalQuantities::CLength &maxRenderedDistance);
+
         qint64 m_timestampMsSinceEpoch = -1;
+        qint64 m_previousTimestampMsSinceEpoch = -1;
+        int m_reRankedCount = 0;
         bool m_restricted = false;
         bool m_renderingEnabled = true;
         bool m_restrictionChanged = false;
         QString m_threadName; //!< generating thread name for debugging purposes
 
-        // remark closest aircraft always first
+        // remark the sets are not ordered by distance, the distance decides which aircraft are enabled
         BlackMisc::Aviation::CCallsignSet m_aircraftCallsignsByDistance;
 
         BlackMisc::Aviation::CCallsignSet m_enabledAircraftCallsignsByDistance;
@@ -107,9 +148,13 @@ namespace BlackMisc::Simulation
         BlackMisc::Aviation::CCallsignSet m_vtolAircraftCallsignsByDistance;
         BlackMisc::Aviation::CCallsignSet m_enabledVtolAircraftCallsignsByDistance;
 
+        QVector<RankedAircraft> m_ranking; //!< all aircraft, closest first, only used locally for the next snapshot
+
         BLACK_METACLASS(
             CAirspaceAircraftSnapshot,
             BLACK_METAMEMBER(timestampMsSinceEpoch),
+            BLACK_METAMEMBER(previousTimestampMsSinceEpoch, 0, DisabledForComparison),
+            BLACK_METAMEMBER(reRankedCount, 0, DisabledForComparison),
             BLACK_METAMEMBER(aircraftCallsignsByDistance, 0, DisabledForComparison),
             BLACK_METAMEMBER(enabledAircraftCallsignsByDistance, 0, DisabledForComparison),
             BLACK_METAMEMBER(disabledAircraftCallsignsByDistance, 0, DisabledForComparison),
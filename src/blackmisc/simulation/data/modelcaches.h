@@ -13,6 +13,7 @@
 
 #include "blackmisc/simulation/aircraftmodelinterfaces.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/aircraftmodellistbinary.h"
 #include "blackmisc/simulation/simulatorinfo.h"
 #include "blackmisc/applicationinfo.h"
 #include "blackmisc/statusmessage.h"
@@ -31,6 +32,15 @@ namespace BlackMisc::Simulation::Data
     {
         //! Defer loading
         static constexpr bool isDeferred() { return true; }
+
+        //! Binary file, model sets can be large
+        static constexpr bool isBinary() { return true; }
+
+        //! \copydoc BlackMisc::TDataTrait::toBinary
+        static QByteArray toBinary(const CAircraftModelList &models) { return CAircraftModelListBinary::toBinary(models); }
+
+        //! \copydoc BlackMisc::TDataTrait::fromBinary
+        static CAircraftModelList fromBinary(const QByteArray &data, BlackMisc::CStatusMessage &o_status) { return CAircraftModelListBinary::fromBinary(data, o_status); }
     };
 
     //! \name Caches for own models on disk, loaded by IAircraftModelLoader
@@ -14,15 +14,32 @@ namespace BlackMisc::Simulation
 {
     CInterpolationAndRenderingSetupPerCallsign IInterpolationSetupProvider::getInterpolationSetupPerCallsignOrDefault(const CCallsign &callsign) const
     {
+        const CCallsignId id(callsign);
         QReadLocker l(&m_lockSetup);
-        if (!m_setupsPerCallsign.contains(callsign)) { return CInterpolationAndRenderingSetupPerCallsign(callsign, m_globalSetup); }
-        return m_setupsPerCallsign.value(callsign);
+        const auto it = m_setupsPerCallsign.constFind(id);
+        if (it == m_setupsPerCallsign.constEnd()) { return CInterpolationAndRenderingSetupPerCallsign(callsign, m_globalSetup); }
+        return it.value();
+    }
+
+    QVector<CInterpolationAndRenderingSetupPerCallsign> IInterpolationSetupProvider::getInterpolationSetupsPerCallsignOrDefault(const QVector<CCallsign> &callsigns) const
+    {
+        QVector<CInterpolationAndRenderingSetupPerCallsign> setups;
+        setups.reserve(callsigns.size());
+        QReadLocker l(&m_lockSetup);
+        for (const CCallsign &callsign : callsigns)
+        {
+            const auto it = m_setupsPerCallsign.constFind(CCallsignId(callsign));
+            setups.push_back(it == m_setupsPerCallsign.constEnd() ? CInterpolationAndRenderingSetupPerCallsign(callsign, m_globalSetup) : it.value());
+        }
+        return setups;
     }
 
     CInterpolationSetupList IInterpolationSetupProvider::getInterpolationSetupsPerCallsign() const
     {
         const SetupsPerCallsign setups = this->getSetupsPerCallsign();
-        return CInterpolationSetupList(setups.values());
+        CInterpolationSetupList setupList(setups.values());
+        setupList.sortByCallsign(); // hash order is arbitrary
+        return setupList;
     }
 
     bool IInterpolationSetupProvider::hasSetupsPerCallsign() const
@@ -38,7 +55,7 @@ namespace BlackMisc::Simulation
         for (const CInterpolationAndRenderingSetupPerCallsign &setup : setups)
         {
             if (ignoreSameAsGlobal && setup.isEqualToGlobal(gs)) { continue; }
-            setupsPerCs.insert(setup.getCallsign(), setup);
+            setupsPerCs.insert(CCallsignId(setup.getCallsign()), setup);
         }
         {
             QWriteLocker l(&m_lockSetup);
@@ -59,18 +76,19 @@ namespace BlackMisc::Simulation
     {
         const SetupsPerCallsign setups = this->getSetupsPerCallsign();
         CCallsignSet callsigns;
-        for (const auto [callsign, setup] : makePairsRange(setups))
+        for (const auto [id, setup] : makePairsRange(setups))
         {
-            if (setup.logInterpolation()) { callsigns.insert(callsign); }
+            if (setup.logInterpolation()) { callsigns.insert(id.toCallsign()); }
         }
         return callsigns;
     }
 
     bool IInterpolationSetupProvider::isLogCallsign(const CCallsign &callsign) const
     {
+        const CCallsignId id(callsign);
         QReadLocker l(&m_lockSetup);
-        if (!m_setupsPerCallsign.contains(callsign)) { return false; }
-        return m_setupsPerCallsign[callsign].logInterpolation();
+        const auto it = m_setupsPerCallsign.constFind(id);
+        return it != m_setupsPerCallsign.constEnd() && it->logInterpolation();
     }
 
     bool IInterpolationSetupProvider::setInterpolationMode(const QString &modeAsString, const CCallsign &callsign)
@@ -104,19 +122,20 @@ namespace BlackMisc::Simulation
 
     bool IInterpolationSetupProvider::setInterpolationSetupPerCallsign(const CInterpolationAndRenderingSetupPerCallsign &setup, const CCallsign &callsign, bool removeGlobalSetup)
     {
+        const CCallsignId id(callsign);
         if (removeGlobalSetup)
         {
             const CInterpolationAndRenderingSetupGlobal gs = this->getInterpolationSetupGlobal();
             if (setup.isEqualToGlobal(gs))
             {
                 QWriteLocker l(&m_lockSetup);
-                m_setupsPerCallsign.remove(callsign);
+                m_setupsPerCallsign.remove(id);
                 return false;
             }
         }
         {
             QWriteLocker l(&m_lockSetup);
-            m_setupsPerCallsign[callsign] = setup;
+            m_setupsPerCallsign[id] = setup;
         }
         this->emitInterpolationSetupChanged();
         return true;
@@ -125,9 +144,10 @@ namespace BlackMisc::Simulation
     bool IInterpolationSetupProvider::removeInterpolationSetupPerCallsign(const CCallsign &callsign)
     {
         bool removed = false;
+        const CCallsignId id(callsign);
         {
             QWriteLocker l(&m_lockSetup);
-            removed = m_setupsPerCallsign.remove(callsign) > 0;
+            removed = m_setupsPerCallsign.remove(id) > 0;
         }
         if (removed) { this->emitInterpolationSetupChanged(); }
         return removed;
@@ -150,11 +170,11 @@ namespace BlackMisc::Simulation
         // on the other side, we keep locks for a minimal time frame
         SetupsPerCallsign setupsToKeep;
         CInterpolationAndRenderingSetupGlobal global = this->getInterpolationSetupGlobal();
-        for (auto [callsign, setup] : makePairsRange(setupsCopy))
+        for (auto [id, setup] : makePairsRange(setupsCopy))
         {
             setup.setLogInterpolation(false);
             if (setup.isEqualToGlobal(global)) { continue; }
-            setupsToKeep.insert(callsign, setup);
+            setupsToKeep.insert(id, setup);
         }
         {
             QWriteLocker l(&m_lockSetup);
@@ -15,8 +15,10 @@
 #include "blackmisc/simulation/interpolationrenderingsetup.h"
 #include "blackmisc/simulation/interpolationsetuplist.h"
 #include "blackmisc/aviation/callsignset.h"
+#include "blackmisc/aviation/callsignid.h"
 #include "blackmisc/provider.h"
-#include <QMap>
+#include <QHash>
+#include <QVector>
 #include <QReadWriteLock>
 
 namespace BlackMisc::Simulation
@@ -25,12 +27,17 @@ namespace BlackMisc::Simulation
     class BLACKMISC_EXPORT IInterpolationSetupProvider : public IProvider
     {
     public:
-        using SetupsPerCallsign = QMap<Aviation::CCallsign, CInterpolationAndRenderingSetupPerCallsign>; //!< setups per callsign
+        using SetupsPerCallsign = QHash<Aviation::CCallsignId, CInterpolationAndRenderingSetupPerCallsign>; //!< setups per callsign, looked up per aircraft and frame
 
         //! Get the setup for callsign, if not existing the global setup
         //! \threadsafe
         CInterpolationAndRenderingSetupPerCallsign getInterpolationSetupPerCallsignOrDefault(const Aviation::CCallsign &callsign) const;
 
+        //! Get the setups for callsigns, the global setup for callsigns without specific setup
+        //! \remark same order as callsigns, locked once for all callsigns
+        //! \threadsafe
+        QVector<CInterpolationAndRenderingSetupPerCallsign> getInterpolationSetupsPerCallsignOrDefault(const QVector<Aviation::CCallsign> &callsigns) const;
+
         //! Get all setups per callsign
         //! \threadsafe
         CInterpolationSetupList getInterpolationSetupsPerCallsign() const;
@@ -41,7 +41,7 @@ namespace BlackMisc::Simulation
                                             ISimulationEnvironmentProvider *simEnvProvider,
                                             IInterpolationSetupProvider    *setupProvider,
                                             IRemoteAircraftProvider *remoteProvider,
-                                            CInterpolationLogger    *logger) : m_callsign(callsign)
+                                            CInterpolationLogger    *logger) : m_callsign(callsign), m_callsignId(callsign)
     {
         // normally when created m_cg is still null since there is no CG in the provider yet
 
@@ -91,11 +91,13 @@ namespace BlackMisc::Simulation
     CAircraftSituationList CInterpolator<Derived>::remoteAircraftSituationsAndChange(const CInterpolationAndRenderingSetupPerCallsign &setup)
     {
         // const bool vtol = setup.isForcingFullInterpolation() || m_model.isVtol();
-        CAircraftSituationList validSituations = this->remoteAircraftSituations(m_callsign);
+        // the provider's list stays shared, the offset is added when a situation is used
+        const CAircraftSituationList validSituations = this->remoteAircraftSituations(m_callsignId);
+        m_currentSituationsOffset = CLength::null();
 
         // get the changes, we need the second value as we want to look in the past
         // the first value is already based on the latest situation
-        const CAircraftSituationChangeList changes = this->remoteAircraftSituationChanges(m_callsign);
+        const CAircraftSituationChangeList changes = this->remoteAircraftSituationChanges(m_callsignId);
         m_pastSituationsChange = changes.indexOrNull(1);
 
         // fixing offset
@@ -105,9 +107,7 @@ namespace BlackMisc::Simulation
             m_currentSceneryOffset = os;
             if (!os.isNull())
             {
-                const CLength addValue = os * -1.0; // positive values means too high, negative values too low
-                int changed = validSituations.addAltitudeOffset(addValue);
-                Q_UNUSED(changed)
+                m_currentSituationsOffset = os * -1.0; // positive values means too high, negative values too low
             }
         }
         else
@@ -415,7 +415,7 @@ namespace BlackMisc::Simulation
         // (!) this code is used by linear and spline interpolator
 
         // Parts are supposed to be in correct order, latest first
-        const CAircraftPartsList validParts = this->remoteAircraftParts(m_callsign);
+        const CAircraftPartsList validParts = this->remoteAircraftParts(m_callsignId);
 
         // log for empty parts aircraft parts
         if (validParts.isEmpty())
@@ -686,6 +686,7 @@ namespace BlackMisc::Simulation
         this->resetLastInterpolation();
         m_model = CAircraftModel();
         m_currentSceneryOffset = CLength::null();
+        m_currentSituationsOffset = CLength::null();
         m_pastSituationsChange = CAircraftSituationChange::null();
         m_currentSituations.clear();
         m_currentTimeMsSinceEpoch = -1;
@@ -704,7 +705,7 @@ namespace BlackMisc::Simulation
     {
         Q_ASSERT_X(!m_callsign.isEmpty(), Q_FUNC_INFO, "Missing callsign");
 
-        const qint64 lastModifed  = this->situationsLastModified(m_callsign);
+        const qint64 lastModifed  = this->situationsLastModified(m_callsignId);
         const bool slowUpdateStep = (((m_interpolatedSituationsCounter + aircraftNumber) % 25) == 0); // flag when parts are updated, which need not to be updated every time
         const bool changedSituations = lastModifed > m_situationsLastModified;
 
@@ -757,7 +758,7 @@ namespace BlackMisc::Simulation
     {
         if (m_currentSituations.isEmpty()) { return CAircraftSituation::null(); }
 
-        CAircraftSituation currentSituation = m_lastSituation.isNull() ? m_currentSituations.front() : m_lastSituation;
+        CAircraftSituation currentSituation = m_lastSituation.isNull() ? this->withCurrentOffset(m_currentSituations.front()) : m_lastSituation;
         if (currentSituation.getCallsign() != m_callsign)
         {
             BLACK_VERIFY_X(false, Q_FUNC_INFO, "Wrong callsign");
@@ -20,6 +20,7 @@
 #include "blackmisc/aviation/aircraftsituation.h"
 #include "blackmisc/aviation/aircraftpartslist.h"
 #include "blackmisc/aviation/callsign.h"
+#include "blackmisc/aviation/callsignid.h"
 #include "blackmisc/logcategories.h"
 #include "blackmisc/statusmessagelist.h"
 
@@ -280,12 +281,13 @@ namespace BlackMisc
             static double groundInterpolationFactor();
 
             const Aviation::CCallsign  m_callsign; //!< corresponding callsign
+            const Aviation::CCallsignId m_callsignId; //!< identifier of m_callsign, provider lookups per step do not hash the callsign
             CAircraftModel m_model; //!< corresponding model
 
             // values for current interpolation step
             qint64 m_currentTimeMsSinceEpoch = -1;                      //!< current time
             qint64 m_lastInvalidLogTs = -1;                             //!< last invalid situation timestamp
-            Aviation::CAircraftSituationList m_currentSituations;       //!< current situations obtained by remoteAircraftSituationsAndChange
+            Aviation::CAircraftSituationList m_currentSituations;       //!< current situations obtained by remoteAircraftSituationsAndChange, shared with the provider
             Aviation::CAircraftSituationChange m_pastSituationsChange;  //!< situations change of provider (i.e. network) situations
             CInterpolationAndRenderingSetupPerCallsign m_currentSetup;  //!< used setup
             CInterpolationStatus m_currentInterpolationStatus;          //!< this step's situation status
@@ -299,6 +301,7 @@ namespace BlackMisc
             Aviation::CAircraftSituation m_lastSituation { Aviation::CAircraftSituation::null() };      //!< latest interpolation
             Aviation::CAircraftParts m_lastParts { Aviation::CAircraftParts::null() };                  //!< latest parts
             PhysicalQuantities::CLength m_currentSceneryOffset { PhysicalQuantities::CLength::null() }; //!< calculated scenery offset if any
+            PhysicalQuantities::CLength m_currentSituationsOffset { PhysicalQuantities::CLength::null() }; //!< altitude offset of m_currentSituations, added when a situation is used
 
             qint64 m_situationsLastModified     { -1 }; //!< when situations were last modified
             qint64 m_situationsLastModifiedUsed { -1 }; //!< interpolant based on situations last updated
@@ -306,6 +309,10 @@ namespace BlackMisc
 
             bool m_unitTest = false; //!< mark as unit test
 
+            //! Situation of m_currentSituations with the altitude offset
+            //! \remark the offset is only added to the few situations interpolated, so m_currentSituations stays shared with the provider
+            Aviation::CAircraftSituation withCurrentOffset(const Aviation::CAircraftSituation &situation) const { return situation.withAltitudeOffset(m_currentSituationsOffset); }
+
             //! Verify gnd flag, times, ... true means "OK"
             bool verifyInterpolationSituations(const Aviation::CAircraftSituation &oldest, const Aviation::CAircraftSituation &newer, const Aviation::CAircraftSituation &latest,
                                                const CInterpolationAndRenderingSetupPerCallsign &setup = CInterpolationAndRenderingSetupPerCallsign::null());
@@ -322,6 +329,7 @@ namespace BlackMisc
 
             //! Get situations and calculate change, also correct altitudes if applicable
             //! \remark calculates offset (scenery) and situations change
+            //! \remark the altitude offset is kept in m_currentSituationsOffset, not added to the situations
             Aviation::CAircraftSituationList remoteAircraftSituationsAndChange(const CInterpolationAndRenderingSetupPerCallsign &setup);
 
             //! Center of gravity, fetched from provider in case needed
@@ -148,7 +148,7 @@ namespace BlackMisc::Simulation
                 // no before situations
                 if (situationsOlder.isEmpty())
                 {
-                    const CAircraftSituation currentSituation(*(situationsNewer.end() - 1)); // oldest newest
+                    const CAircraftSituation currentSituation(this->withCurrentOffset(*(situationsNewer.end() - 1))); // oldest newest
                     m_currentInterpolationStatus.setInterpolatedAndCheckSituation(false, currentSituation);
                     m_interpolant = { currentSituation };
                     return m_interpolant;
@@ -157,20 +157,20 @@ namespace BlackMisc::Simulation
                 // only one before situation
                 if (situationsOlder.size() < 2)
                 {
-                    const CAircraftSituation currentSituation(situationsOlder.front()); // latest oldest
+                    const CAircraftSituation currentSituation(this->withCurrentOffset(situationsOlder.front())); // latest oldest
                     m_currentInterpolationStatus.setInterpolatedAndCheckSituation(false, currentSituation);
                     m_interpolant = { currentSituation };
                     return m_interpolant;
                 }
 
                 // extrapolate from two before situations
-                oldSituation = *(situationsOlder.begin() + 1); // before newest
-                newSituation = situationsOlder.front(); // newest
+                oldSituation = this->withCurrentOffset(*(situationsOlder.begin() + 1)); // before newest
+                newSituation = this->withCurrentOffset(situationsOlder.front()); // newest
             }
             else
             {
-                oldSituation = situationsOlder.front(); // first oldest (aka newest oldest)
-                newSituation = *(situationsNewer.end() - 1); // latest newest (aka oldest of newer block)
+                oldSituation = this->withCurrentOffset(situationsOlder.front()); // first oldest (aka newest oldest)
+                newSituation = this->withCurrentOffset(*(situationsNewer.end() - 1)); // latest newest (aka oldest of newer block)
                 Q_ASSERT(oldSituation.getAdjustedMSecsSinceEpoch() < newSituation.getAdjustedMSecsSinceEpoch());
             }
 
@@ -120,7 +120,7 @@ namespace BlackMisc::Simulation
             else
             {
                 // we start with the latest situation just to init the values
-                CAircraftSituation f = m_currentSituations.front();
+                CAircraftSituation f = this->withCurrentOffset(m_currentSituations.front());
                 f.setAdjustedMSecsSinceEpoch(m_currentTimeMsSinceEpoch); // adjusted time exactly "now"
                 m_s[0] = m_s[1] = m_s[2] = f;
             }
@@ -139,7 +139,7 @@ namespace BlackMisc::Simulation
 
         // and use the real values if available
         // m_s[0] .. oldest -> m_[2] .. latest
-        const CAircraftSituation latest = m_currentSituations.front();
+        const CAircraftSituation latest = this->withCurrentOffset(m_currentSituations.front());
         if (latest.isNewerThanAdjusted(m_s[1])) { m_s[2] = latest; }
         const qint64 currentAdjusted = m_s[1].getAdjustedMSecsSinceEpoch();
 
@@ -149,12 +149,12 @@ namespace BlackMisc::Simulation
         const CAircraftSituation older = m_currentSituations.findObjectBeforeAdjustedOrDefault(currentAdjusted - osNotTooClose);
         if (!older.isNull())
         {
-            m_s[0] = older;
+            m_s[0] = this->withCurrentOffset(older);
         }
         else
         {
             const CAircraftSituation closeOlder = m_currentSituations.findObjectBeforeAdjustedOrDefault(currentAdjusted);
-            if (!closeOlder.isNull()) { m_s[0] = closeOlder; }
+            if (!closeOlder.isNull()) { m_s[0] = this->withCurrentOffset(closeOlder); }
         }
         const qint64 latestAdjusted = m_s[2].getAdjustedMSecsSinceEpoch();
         const qint64 olderAdjusted  = m_s[0].getAdjustedMSecsSinceEpoch();
@@ -143,6 +143,31 @@ namespace BlackMisc::Simulation
         emit this->rerunChanged();
     }
 
+    void MSInOutValues::initByModel(const CAircraftModel &model)
+    {
+        const MSInOutValues v(model);
+        m_callsign         = v.m_callsign;
+        m_callsignAsSet    = v.m_callsignAsSet;
+        m_flightNumber     = v.m_flightNumber;
+        m_aircraftIcao     = v.m_aircraftIcao;
+        m_aircraftFamily   = v.m_aircraftFamily;
+        m_combinedType     = v.m_combinedType;
+        m_airlineIcao      = v.m_airlineIcao;
+        m_vAirlineIcao     = v.m_vAirlineIcao;
+        m_livery           = v.m_livery;
+        m_modelString      = v.m_modelString;
+        m_dbAircraftIcaoId = v.m_dbAircraftIcaoId;
+        m_dbAirlineIcaoId  = v.m_dbAirlineIcaoId;
+        m_dbLiveryId       = v.m_dbLiveryId;
+        m_dbModelId        = v.m_dbModelId;
+        m_logMessage       = v.m_logMessage;
+        m_modifiedAircraftDesignator = v.m_modifiedAircraftDesignator;
+        m_modifiedAircraftFamily     = v.m_modifiedAircraftFamily;
+        m_modifiedAirlineDesignator  = v.m_modifiedAirlineDesignator;
+        m_modified = v.m_modified;
+        m_rerun    = v.m_rerun;
+    }
+
     void MSInOutValues::evaluateChanges(const CAircraftIcaoCode &aircraft, const CAirlineIcaoCode &airline)
     {
         m_modifiedAircraftDesignator = aircraft.getDesignator() != m_aircraftIcao;
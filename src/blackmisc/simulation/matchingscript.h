@@ -155,6 +155,9 @@ namespace BlackMisc::Simulation
         void setRerun(bool rerun);
         //! @}
 
+        //! Reset all values to those of model, allows to reuse an object already exposed to JavaScript
+        void initByModel(const BlackMisc::Simulation::CAircraftModel &model);
+
         //! Changed values such as modified values
         void evaluateChanges(const BlackMisc::Aviation::CAircraftIcaoCode &aircraft, const BlackMisc::Aviation::CAirlineIcaoCode &airline);
 
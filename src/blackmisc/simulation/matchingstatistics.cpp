@@ -81,4 +81,10 @@ namespace BlackMisc::Simulation
         }
         this->push_back(CMatchingStatisticsEntry(type, sessionId, modelSetId, description, aircraftDesignator, airlineDesignator));
     }
+
+    double CMatchingStatistics::getMatchingCacheHitRatio() const
+    {
+        const int lookups = m_matchingCacheHits + m_matchingCacheMisses;
+        return lookups > 0 ? static_cast<double>(m_matchingCacheHits) / lookups : 0.0;
+    }
 } // namespace
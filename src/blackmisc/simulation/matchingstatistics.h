@@ -61,6 +61,21 @@ namespace BlackMisc::Simulation
 
         //! Add a combination, normally with no duplicates (in that case count is increased
         void addAircraftAirlineCombination(CMatchingStatisticsEntry::EntryType type, const QString &sessionId, const QString &modelSetId, const QString &description, const QString &aircraftDesignator, const QString &airlineDesignator, bool avoidDuplicates = true);
+
+        //! Matching cache hits and misses
+        //! \remark set by the matcher, not part of the entries and not marshalled
+        //! @{
+        int getMatchingCacheHits() const { return m_matchingCacheHits; }
+        int getMatchingCacheMisses() const { return m_matchingCacheMisses; }
+        void setMatchingCacheCounts(int hits, int misses) { m_matchingCacheHits = hits; m_matchingCacheMisses = misses; }
+        //! @}
+
+        //! Ratio of matching cache hits 0..1, 0 if there were no lookups
+        double getMatchingCacheHitRatio() const;
+
+    private:
+        int m_matchingCacheHits   = 0; //!< matches taken from the cache
+        int m_matchingCacheMisses = 0; //!< matches calculated
     };
 } // namespace
 
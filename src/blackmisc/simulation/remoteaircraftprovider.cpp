@@ -22,6 +22,8 @@ using namespace BlackConfig;
 
 namespace BlackMisc::Simulation
 {
+    static_assert(IRemoteAircraftProvider::MaxSituationsPerCallsign <= CAircraftSituationRunningStatistics::Capacity, "Running statistics too small");
+
     IRemoteAircraftProvider::IRemoteAircraftProvider()
     { }
 
@@ -70,10 +72,14 @@ namespace BlackMisc::Simulation
 
     CAircraftSituationList CRemoteAircraftProvider::remoteAircraftSituations(const CCallsign &callsign) const
     {
-        static const CAircraftSituationList empty;
-        QReadLocker l(&m_lockSituations);
-        if (!m_situationsByCallsign.contains(callsign)) { return empty; }
-        return m_situationsByCallsign[callsign];
+        return this->remoteAircraftSituations(CCallsignId(callsign));
+    }
+
+    CAircraftSituationList CRemoteAircraftProvider::remoteAircraftSituations(CCallsignId callsignId) const
+    {
+        CAircraftSituationList situations;
+        m_situationsByCallsign.read(callsignId, [&](const SituationsPerCallsign &perCallsign) { situations = perCallsign.situations; });
+        return situations;
     }
 
     CAircraftSituation CRemoteAircraftProvider::remoteAircraftSituation(const CCallsign &callsign, int index) const
@@ -91,40 +97,48 @@ namespace BlackMisc::Simulation
 
     CAircraftSituationList CRemoteAircraftProvider::latestRemoteAircraftSituations() const
     {
-        QReadLocker l(&m_lockSituations);
-        const QList<CAircraftSituation> situations(m_latestSituationByCallsign.values());
-        l.unlock();
-        return CAircraftSituationList(situations);
+        CAircraftSituationList situations;
+        m_situationsByCallsign.forEach([&](CCallsignId, const SituationsPerCallsign &perCallsign)
+        {
+            if (perCallsign.hasLatestSituation) { situations.push_back(perCallsign.latestSituation); }
+        });
+        return situations;
     }
 
     CAircraftSituationList CRemoteAircraftProvider::latestOnGroundProviderElevations() const
     {
-        QReadLocker l(&m_lockSituations);
-        const QList<CAircraftSituation> situations(m_latestOnGroundProviderElevation.values());
-        l.unlock();
-        return CAircraftSituationList(situations);
+        CAircraftSituationList situations;
+        m_situationsByCallsign.forEach([&](CCallsignId, const SituationsPerCallsign &perCallsign)
+        {
+            if (perCallsign.hasLatestOnGroundProviderElevation) { situations.push_back(perCallsign.latestOnGroundProviderElevation); }
+        });
+        return situations;
     }
 
     int CRemoteAircraftProvider::remoteAircraftSituationsCount(const CCallsign &callsign) const
     {
-        QReadLocker l(&m_lockSituations);
-        if (!m_situationsByCallsign.contains(callsign)) { return -1; }
-        return m_situationsByCallsign[callsign].size();
+        int count = -1;
+        m_situationsByCallsign.read(CCallsignId(callsign), [&](const SituationsPerCallsign &perCallsign) { count = perCallsign.situations.size(); });
+        return count;
     }
 
     CAircraftPartsList CRemoteAircraftProvider::remoteAircraftParts(const CCallsign &callsign) const
     {
-        static const CAircraftPartsList empty;
+        return this->remoteAircraftParts(CCallsignId(callsign));
+    }
+
+    CAircraftPartsList CRemoteAircraftProvider::remoteAircraftParts(CCallsignId callsignId) const
+    {
         QReadLocker l(&m_lockParts);
-        if (!m_partsByCallsign.contains(callsign)) { return empty; }
-        return m_partsByCallsign[callsign];
+        return m_partsByCallsign.value(callsignId);
     }
 
     int CRemoteAircraftProvider::remoteAircraftPartsCount(const CCallsign &callsign) const
     {
+        const CCallsignId id(callsign);
         QReadLocker l(&m_lockParts);
-        if (!m_partsByCallsign.contains(callsign)) { return -1; }
-        return m_partsByCallsign[callsign].size();
+        const auto it = m_partsByCallsign.constFind(id);
+        return it == m_partsByCallsign.constEnd() ? -1 : it->size();
     }
 
     bool CRemoteAircraftProvider::isRemoteAircraftSupportingParts(const CCallsign &callsign) const
@@ -147,14 +161,19 @@ namespace BlackMisc::Simulation
 
     CAircraftSituationChangeList CRemoteAircraftProvider::remoteAircraftSituationChanges(const CCallsign &callsign) const
     {
-        QReadLocker l(&m_lockChanges);
-        return m_changesByCallsign[callsign];
+        return this->remoteAircraftSituationChanges(CCallsignId(callsign));
+    }
+
+    CAircraftSituationChangeList CRemoteAircraftProvider::remoteAircraftSituationChanges(CCallsignId callsignId) const
+    {
+        return m_changesByCallsign.value(callsignId);
     }
 
     int CRemoteAircraftProvider::remoteAircraftSituationChangesCount(const CCallsign &callsign) const
     {
-        QReadLocker l(&m_lockChanges);
-        return m_changesByCallsign[callsign].size();
+        int count = 0;
+        m_changesByCallsign.read(CCallsignId(callsign), [&](const CAircraftSituationChangeList &changes) { count = changes.size(); });
+        return count;
     }
 
     int CRemoteAircraftProvider::getAircraftInRangeCount() const
@@ -175,19 +194,13 @@ namespace BlackMisc::Simulation
             m_partsAdded = 0;
             m_partsLastModified.clear();
         }
+        m_situationsByCallsign.clear();
+        m_situationsAdded = 0;
         {
             QWriteLocker l(&m_lockSituations);
-            m_situationsByCallsign.clear();
-            m_latestSituationByCallsign.clear();
-            m_latestOnGroundProviderElevation.clear();
-            m_situationsAdded = 0;
-            m_situationsLastModified.clear();
             m_testOffset.clear();
         }
-        {
-            QWriteLocker l(&m_lockChanges);
-            m_changesByCallsign.clear();
-        }
+        m_changesByCallsign.clear();
 
         { QWriteLocker l(&m_lockPartsHistory); m_aircraftPartsMessages.clear(); }
         { QWriteLocker l(&m_lockMessages); m_reverseLookupMessages.clear(); }
@@ -257,6 +270,7 @@ namespace BlackMisc::Simulation
     {
         const CCallsign cs = situation.getCallsign();
         if (cs.isEmpty()) { return situation; }
+        const CCallsignId id(cs);
 
         // testing
         if (CBuildConfig::isLocalDeveloperDebugBuild())
@@ -276,37 +290,55 @@ namespace BlackMisc::Simulation
         }
 
         // list from new to old
-        CAircraftSituationList updatedSituations; // copy of updated situations
+        CAircraftSituationChange change;
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        m_situationsAdded++;
+        const bool stored = m_situationsByCallsign.modify(id, [&](SituationsPerCallsign &perCallsign)
         {
-            const qint64 now = QDateTime::currentMSecsSinceEpoch();
-            QWriteLocker lock(&m_lockSituations);
-            m_situationsAdded++;
-            m_situationsLastModified[cs] = now;
-            CAircraftSituationList &newSituationsList = m_situationsByCallsign[cs];
+            // only the stripe of this callsign is locked
+            perCallsign.lastModified = now;
+            CAircraftSituationList &newSituationsList = perCallsign.situations;
+            CAircraftSituationRunningStatistics &statistics = perCallsign.statistics;
             newSituationsList.setAdjustedSortHint(CAircraftSituationList::AdjustedTimestampLatestFirst);
             const int situations = newSituationsList.size();
             if (situations < 1)
             {
                 newSituationsList.prefillLatestAdjustedFirst(situationCorrected, IRemoteAircraftProvider::MaxSituationsPerCallsign);
+                statistics.rebuild(newSituationsList);
             }
             else if (!situationCorrected.hasVelocity() && newSituationsList.front().hasVelocity())
             {
-                return situationCorrected;
+                return false;
             }
             else
             {
+                const bool replacesLatest = newSituationsList.front().getMSecsSinceEpoch() == situationCorrected.getMSecsSinceEpoch();
+
                 // newSituationsList.push_frontKeepLatestFirstIgnoreOverlapping(situationCorrected, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
                 newSituationsList.push_frontKeepLatestFirstAdjustOffset(situationCorrected, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
                 newSituationsList.setAdjustedSortHint(CAircraftSituationList::AdjustedTimestampLatestFirst);
-                newSituationsList.transferElevationForward(); // transfer elevations, will do nothing if elevations already exist
+                const int transferred = newSituationsList.transferElevationForward(); // transfer elevations, will do nothing if elevations already exist
 
                 // unify all inbound ground information
                 if (situation.hasInboundGroundDetails())
                 {
                     newSituationsList.setOnGroundDetails(situation.getOnGroundDetails());
                 }
+
+                // O(1) update if the new situation simply became the latest one,
+                // rebuild if situations were re-sorted, replaced or got elevations
+                const CAircraftSituation &latest = newSituationsList.front();
+                const int expectedTransferred = (!situationCorrected.hasGroundElevation() && latest.hasGroundElevation()) ? 1 : 0;
+                const bool isNewLatest = !replacesLatest && latest.getMSecsSinceEpoch() == situationCorrected.getMSecsSinceEpoch();
+                const bool incremental = statistics.isValid() && isNewLatest && transferred == expectedTransferred;
+                if (incremental) { statistics.addLatest(latest, IRemoteAircraftProvider::MaxSituationsPerCallsign); }
+                if (!incremental || statistics.size() != newSituationsList.size())
+                {
+                    statistics.rebuild(newSituationsList);
+                }
             }
-            m_latestSituationByCallsign[cs] = situationCorrected;
+            perCallsign.latestSituation = situationCorrected;
+            perCallsign.hasLatestSituation = true;
 
             // check sort order
             if (CBuildConfig::isLocalDeveloperDebugBuild())
@@ -318,29 +350,27 @@ namespace BlackMisc::Simulation
 
             if (!situation.hasInboundGroundDetails())
             {
-                // first use a version without standard deviations to guess "on ground
-                const CAircraftSituationChange simpleChange(updatedSituations, situationCorrected.getCG(), aircraftModel.isVtol(), true, false);
-
-                // guess GND
-                simpleChange.guessOnGround(newSituationsList.front(), aircraftModel);
+                // guess GND, the change of the situations is not yet known here
+                CAircraftSituationChange::null().guessOnGround(newSituationsList.front(), aircraftModel);
             }
-            updatedSituations = m_situationsByCallsign[cs];
-
-        } // lock
 
-        // calculate change AFTER gnd. was guessed
-        Q_ASSERT_X(!updatedSituations.isEmpty(), Q_FUNC_INFO, "Missing situations");
-        const CAircraftSituationChange change(updatedSituations, situationCorrected.getCG(), aircraftModel.isVtol(), true, true);
-        this->storeChange(change);
+            // calculate change AFTER gnd. was guessed
+            change = CAircraftSituationChange(newSituationsList, statistics, situationCorrected.getCG(), aircraftModel.isVtol());
+            return true;
+        });
+        if (!stored) { return situationCorrected; }
+        this->storeChange(id, change);
 
         if (change.hasSceneryDeviation())
         {
             const CLength offset = change.getGuessedSceneryDeviation();
             situationCorrected.setSceneryOffset(offset);
 
-            QWriteLocker lock(&m_lockSituations);
-            m_latestSituationByCallsign[cs].setSceneryOffset(offset);
-            m_situationsByCallsign[cs].front().setSceneryOffset(offset);
+            m_situationsByCallsign.modifyIfExists(id, [&](SituationsPerCallsign &perCallsign)
+            {
+                perCallsign.latestSituation.setSceneryOffset(offset);
+                if (!perCallsign.situations.isEmpty()) { perCallsign.situations.front().setSceneryOffset(offset); }
+            });
         }
 
         // situation has been added
@@ -356,13 +386,14 @@ namespace BlackMisc::Simulation
         if (callsign.isEmpty()) { return; }
 
         // list sorted from new to old
+        const CCallsignId id(callsign);
         const qint64 ts = QDateTime::currentMSecsSinceEpoch();
         CAircraftPartsList correctiveParts;
         {
             QWriteLocker lock(&m_lockParts);
             m_partsAdded++;
-            m_partsLastModified[callsign] = ts;
-            CAircraftPartsList &partsList = m_partsByCallsign[callsign];
+            m_partsLastModified[id] = ts;
+            CAircraftPartsList &partsList = m_partsByCallsign[id];
             partsList.push_frontKeepLatestFirstAdjustOffset(parts, true, IRemoteAircraftProvider::MaxPartsPerCallsign);
             partsList.setAdjustedSortHint(CAircraftPartsList::AdjustedTimestampLatestFirst);
 
@@ -378,10 +409,11 @@ namespace BlackMisc::Simulation
         // adjust gnd.flag from parts
         if (!correctiveParts.isEmpty())
         {
-            QWriteLocker lock(&m_lockSituations);
-            CAircraftSituationList &situationList = m_situationsByCallsign[callsign];
-            const int c = situationList.adjustGroundFlag(parts);
-            if (c > 0) { m_situationsLastModified[callsign] = ts; }
+            m_situationsByCallsign.modifyIfExists(id, [&](SituationsPerCallsign &perCallsign)
+            {
+                const int c = perCallsign.situations.adjustGroundFlag(parts);
+                if (c > 0) { perCallsign.lastModified = ts; }
+            });
         }
 
         // update aircraft
@@ -492,13 +524,13 @@ namespace BlackMisc::Simulation
         }
     }
 
-    void CRemoteAircraftProvider::storeChange(const CAircraftSituationChange &change)
+    void CRemoteAircraftProvider::storeChange(CCallsignId id, const CAircraftSituationChange &change)
     {
         // a change with the same timestamp will be replaced
-        const CCallsign cs(change.getCallsign());
-        QWriteLocker lock(&m_lockChanges);
-        CAircraftSituationChangeList &changeList = m_changesByCallsign[cs];
-        changeList.push_frontKeepLatestAdjustedFirst(change, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
+        m_changesByCallsign.modify(id, [&](CAircraftSituationChangeList &changeList)
+        {
+            changeList.push_frontKeepLatestAdjustedFirst(change, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
+        });
     }
 
     bool CRemoteAircraftProvider::guessOnGroundAndUpdateModelCG(CAircraftSituation &situation, const CAircraftSituationChange &change, const CAircraftModel &aircraftModel)
@@ -587,24 +619,28 @@ namespace BlackMisc::Simulation
         bool setForOnGndPosition = false;
 
         int updated = 0;
+        const CCallsignId id(callsign);
+        m_situationsByCallsign.modifyIfExists(id, [&](SituationsPerCallsign &perCallsign)
         {
-            QWriteLocker l(&m_lockSituations);
-            CAircraftSituationList &situations = m_situationsByCallsign[callsign];
-            if (situations.isEmpty()) { return 0; }
+            CAircraftSituationList &situations = perCallsign.situations;
+            if (situations.isEmpty()) { return; }
             updated = setGroundElevationCheckedAndGuessGround(situations, elevation, info, model, &change, &setForOnGndPosition);
-            if (updated < 1) { return 0; }
-            m_situationsLastModified[callsign] = now;
-            const CAircraftSituation latestSituation = situations.front();
+            if (updated < 1) { return; }
+            perCallsign.statistics.invalidate(); // elevations changed, rebuilt with the next situation
+            perCallsign.lastModified = now;
+            const CAircraftSituation &latestSituation = situations.front();
             if (info == CAircraftSituation::FromProvider && latestSituation.isOnGround())
             {
-                m_latestOnGroundProviderElevation[callsign] = latestSituation;
+                perCallsign.latestOnGroundProviderElevation = latestSituation;
+                perCallsign.hasLatestOnGroundProviderElevation = true;
             }
-        }
+        });
+        if (updated < 1) { return 0; }
 
         // update change
         if (!change.isNull())
         {
-            this->storeChange(change);
+            this->storeChange(id, change);
         }
 
         // aircraft updates
@@ -839,20 +875,30 @@ namespace BlackMisc::Simulation
 
     int CRemoteAircraftProvider::aircraftSituationsAdded() const
     {
-        QReadLocker l(&m_lockSituations);
         return m_situationsAdded;
     }
 
     qint64 CRemoteAircraftProvider::situationsLastModified(const CCallsign &callsign) const
     {
-        QReadLocker l(&m_lockSituations);
-        return m_situationsLastModified.value(callsign, -1);
+        return this->situationsLastModified(CCallsignId(callsign));
+    }
+
+    qint64 CRemoteAircraftProvider::situationsLastModified(CCallsignId callsignId) const
+    {
+        qint64 lastModified = -1;
+        m_situationsByCallsign.read(callsignId, [&](const SituationsPerCallsign &perCallsign) { lastModified = perCallsign.lastModified; });
+        return lastModified;
     }
 
     qint64 CRemoteAircraftProvider::partsLastModified(const CCallsign &callsign) const
+    {
+        return this->partsLastModified(CCallsignId(callsign));
+    }
+
+    qint64 CRemoteAircraftProvider::partsLastModified(CCallsignId callsignId) const
     {
         QReadLocker l(&m_lockParts);
-        return m_partsLastModified.value(callsign, -1);
+        return m_partsLastModified.value(callsignId, -1);
     }
 
     CElevationPlane CRemoteAircraftProvider::averageElevationOfNonMovingAircraft(const CAircraftSituation &reference, const CLength &range, int minValues, int sufficientValues) const
@@ -919,19 +965,14 @@ namespace BlackMisc::Simulation
 
     bool CRemoteAircraftProvider::removeAircraft(const CCallsign &callsign)
     {
+        const CCallsignId id(callsign);
         {
             QWriteLocker l1(&m_lockParts);
-            m_partsByCallsign.remove(callsign);
+            m_partsByCallsign.remove(id);
             m_aircraftWithParts.remove(callsign);
-            m_partsLastModified.remove(callsign);
-        }
-        {
-            QWriteLocker l2(&m_lockSituations);
-            m_situationsByCallsign.remove(callsign);
-            m_latestSituationByCallsign.remove(callsign);
-            m_latestOnGroundProviderElevation.remove(callsign);
-            m_situationsLastModified.remove(callsign);
+            m_partsLastModified.remove(id);
         }
+        m_situationsByCallsign.remove(id);
         { QWriteLocker l4(&m_lockPartsHistory); m_aircraftPartsMessages.remove(callsign); }
         bool removedCallsign = false;
         {
@@ -1126,6 +1167,36 @@ namespace BlackMisc::Simulation
         return this->provider()->partsLastModified(callsign);
     }
 
+    CAircraftSituationList CRemoteAircraftAware::remoteAircraftSituations(CCallsignId callsignId) const
+    {
+        Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
+        return this->provider()->remoteAircraftSituations(callsignId);
+    }
+
+    CAircraftPartsList CRemoteAircraftAware::remoteAircraftParts(CCallsignId callsignId) const
+    {
+        Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
+        return this->provider()->remoteAircraftParts(callsignId);
+    }
+
+    CAircraftSituationChangeList CRemoteAircraftAware::remoteAircraftSituationChanges(CCallsignId callsignId) const
+    {
+        Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
+        return this->provider()->remoteAircraftSituationChanges(callsignId);
+    }
+
+    qint64 CRemoteAircraftAware::situationsLastModified(CCallsignId callsignId) const
+    {
+        Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
+        return this->provider()->situationsLastModified(callsignId);
+    }
+
+    qint64 CRemoteAircraftAware::partsLastModified(CCallsignId callsignId) const
+    {
+        Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
+        return this->provider()->partsLastModified(callsignId);
+    }
+
     CElevationPlane CRemoteAircraftAware::averageElevationOfNonMovingAircraft(const CAircraftSituation &reference, const CLength &range, int minValues) const
     {
         Q_ASSERT_X(this->provider(), Q_FUNC_INFO, "No object available");
@@ -18,11 +18,14 @@
 #include "blackmisc/aviation/aircraftpartslist.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
 #include "blackmisc/aviation/aircraftsituationchangelist.h"
+#include "blackmisc/aviation/aircraftsituationrunningstatistics.h"
 #include "blackmisc/aviation/percallsign.h"
+#include "blackmisc/aviation/callsignid.h"
 #include "blackmisc/aviation/callsignset.h"
 #include "blackmisc/provider.h"
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/identifiable.h"
+#include "blackmisc/lockstripedhash.h"
 
 #include <QHash>
 #include <QList>
@@ -32,6 +35,7 @@
 #include <QtGlobal>
 #include <QReadWriteLock>
 #include <functional>
+#include <atomic>
 
 namespace BlackMisc
 {
@@ -253,6 +257,17 @@ namespace BlackMisc
             //! \threadsafe
             virtual qint64 partsLastModified(const Aviation::CCallsign &callsign) const = 0;
 
+            //! Situations, parts, changes and when they were last modified, by identifier of the callsign
+            //! \remark for callers keeping the identifier, like the interpolators, the callsign string is not hashed per call
+            //! \threadsafe
+            //! @{
+            virtual Aviation::CAircraftSituationList remoteAircraftSituations(Aviation::CCallsignId callsignId) const = 0;
+            virtual Aviation::CAircraftPartsList remoteAircraftParts(Aviation::CCallsignId callsignId) const = 0;
+            virtual Aviation::CAircraftSituationChangeList remoteAircraftSituationChanges(Aviation::CCallsignId callsignId) const = 0;
+            virtual qint64 situationsLastModified(Aviation::CCallsignId callsignId) const = 0;
+            virtual qint64 partsLastModified(Aviation::CCallsignId callsignId) const = 0;
+            //! @}
+
             //! Average elevation of aircraft in given range, which are NOT moving
             //! \remark can be used to anticipate field elevation
             //! \threadsafe
@@ -348,6 +363,11 @@ namespace BlackMisc::Simulation
         virtual int aircraftPartsAdded() const override;
         virtual qint64 situationsLastModified(const Aviation::CCallsign &callsign) const override;
         virtual qint64 partsLastModified(const Aviation::CCallsign &callsign) const override;
+        virtual Aviation::CAircraftSituationList remoteAircraftSituations(Aviation::CCallsignId callsignId) const override;
+        virtual Aviation::CAircraftPartsList remoteAircraftParts(Aviation::CCallsignId callsignId) const override;
+        virtual Aviation::CAircraftSituationChangeList remoteAircraftSituationChanges(Aviation::CCallsignId callsignId) const override;
+        virtual qint64 situationsLastModified(Aviation::CCallsignId callsignId) const override;
+        virtual qint64 partsLastModified(Aviation::CCallsignId callsignId) const override;
         virtual Geo::CElevationPlane averageElevationOfNonMovingAircraft(const Aviation::CAircraftSituation &reference, const PhysicalQuantities::CLength &range, int minValues = 1, int sufficientValues = 2) const override;
         virtual QList<QMetaObject::Connection> connectRemoteAircraftProviderSignals(
             QObject *receiver,
@@ -479,23 +499,33 @@ namespace BlackMisc::Simulation
         //! Store the latest changes
         //! \remark latest first
         //! \threadsafe
-        void storeChange(const Aviation::CAircraftSituationChange &change);
+        void storeChange(Aviation::CCallsignId id, const Aviation::CAircraftSituationChange &change);
+
+        //! Situation data of one callsign, guarded by the stripe lock of m_situationsByCallsign
+        struct SituationsPerCallsign
+        {
+            Aviation::CAircraftSituationList situations;                       //!< situations, latest first
+            Aviation::CAircraftSituation latestSituation;                      //!< latest situation
+            Aviation::CAircraftSituation latestOnGroundProviderElevation;      //!< latest situation on ground with elevation from provider
+            Aviation::CAircraftSituationRunningStatistics statistics;          //!< running statistics of situations, used for the changes
+            qint64 lastModified = -1;                                          //!< when situations last modified
+            bool hasLatestSituation = false;                                   //!< latestSituation set?
+            bool hasLatestOnGroundProviderElevation = false;                   //!< latestOnGroundProviderElevation set?
+        };
 
-        Aviation::CAircraftSituationListPerCallsign m_situationsByCallsign;        //!< situations, for performance reasons per callsign, thread safe access required
-        Aviation::CAircraftSituationPerCallsign m_latestSituationByCallsign;       //!< latest situations, for performance reasons per callsign, thread safe access required
-        Aviation::CAircraftSituationPerCallsign m_latestOnGroundProviderElevation; //!< situations on ground with elevation from provider
-        Aviation::CAircraftPartsListPerCallsign m_partsByCallsign;                 //!< parts, for performance reasons per callsign, thread safe access required
-        Aviation::CAircraftSituationChangeListPerCallsign m_changesByCallsign;     //!< changes, for performance reasons per callsign, thread safe access required (same timestamps as corresponding situations)
+        // situations and parts are keyed by interned callsign, so each situation/parts update hashes the callsign string once
+        CLockStripedHash<Aviation::CCallsignId, SituationsPerCallsign> m_situationsByCallsign; //!< situations per callsign, writers of different aircraft do not block each other
+        QHash<Aviation::CCallsignId, Aviation::CAircraftPartsList> m_partsByCallsign; //!< parts, for performance reasons per callsign, thread safe access required
+        CLockStripedHash<Aviation::CCallsignId, Aviation::CAircraftSituationChangeList> m_changesByCallsign; //!< changes per callsign (same timestamps as corresponding situations)
         Aviation::CCallsignSet m_aircraftWithParts;                                //!< aircraft supporting parts, thread safe access required
-        int m_situationsAdded = 0; //!< total number of situations added, thread safe access required
+        std::atomic_int m_situationsAdded { 0 }; //!< total number of situations added
         int m_partsAdded      = 0; //!< total number of parts added, thread safe access required
 
         ReverseLookupLogging m_enableReverseLookupMsgs = RevLogSimplifiedInfo;     //!< shall we log. information about the matching process
         Simulation::CSimulatedAircraftPerCallsign m_aircraftInRange;      //!< aircraft, thread safe access required
         Aviation::CStatusMessageListPerCallsign m_reverseLookupMessages;  //!< reverse lookup messages
         Aviation::CStatusMessageListPerCallsign m_aircraftPartsMessages;  //!< status messages for parts history
-        Aviation::CTimestampPerCallsign m_situationsLastModified;         //!< when situations last modified
-        Aviation::CTimestampPerCallsign m_partsLastModified;              //!< when parts last modified
+        QHash<Aviation::CCallsignId, qint64> m_partsLastModified;         //!< when parts last modified
         Aviation::CLengthPerCallsign    m_testOffset;                     //!< offsets
         Aviation::CLengthPerCallsign    m_dbCGPerCallsign;                //!< DB CG per callsign
         QHash<QString, PhysicalQuantities::CLength> m_dbCGPerModelString; //!< DB CG per model string
@@ -503,9 +533,8 @@ namespace BlackMisc::Simulation
         bool m_enableAircraftPartsHistory = true;  //!< shall we keep a history of aircraft parts
 
         // locks
-        mutable QReadWriteLock m_lockSituations;   //!< lock for situations: m_situationsByCallsign
+        mutable QReadWriteLock m_lockSituations;   //!< lock for test offsets: m_testOffset
         mutable QReadWriteLock m_lockParts;        //!< lock for parts: m_partsByCallsign, m_aircraftSupportingParts
-        mutable QReadWriteLock m_lockChanges;      //!< lock for changes: m_changesByCallsign
         mutable QReadWriteLock m_lockAircraft;     //!< lock aircraft: m_aircraftInRange, m_dbCGPerCallsign
         mutable QReadWriteLock m_lockMessages;     //!< lock for messages
         mutable QReadWriteLock m_lockPartsHistory; //!< lock for aircraft parts
@@ -623,6 +652,15 @@ namespace BlackMisc::Simulation
         //! \copydoc IRemoteAircraftProvider::partsLastModified
         qint64 partsLastModified(const Aviation::CCallsign &callsign) const;
 
+        //! \copydoc IRemoteAircraftProvider::remoteAircraftSituations(Aviation::CCallsignId) const
+        //! @{
+        Aviation::CAircraftSituationList remoteAircraftSituations(Aviation::CCallsignId callsignId) const;
+        Aviation::CAircraftPartsList remoteAircraftParts(Aviation::CCallsignId callsignId) const;
+        Aviation::CAircraftSituationChangeList remoteAircraftSituationChanges(Aviation::CCallsignId callsignId) const;
+        qint64 situationsLastModified(Aviation::CCallsignId callsignId) const;
+        qint64 partsLastModified(Aviation::CCallsignId callsignId) const;
+        //! @}
+
         //! \copydoc IRemoteAircraftProvider::averageElevationOfNonMovingAircraft
         Geo::CElevationPlane averageElevationOfNonMovingAircraft(const Aviation::CAircraftSituation &reference, const PhysicalQuantities::CLength &range, int minValues = 1) const;
 
@@ -79,19 +79,17 @@ namespace BlackMisc::Simulation
 
         const qint64 now = QDateTime::currentMSecsSinceEpoch();
         {
-            // we keep latest at front
-            // * we assume we find them faster
-            // * and need them more frequently (the recent ones)
+            // the oldest elevations are evicted
             QWriteLocker l(&m_lockElvCoordinates);
             if (likelyOnGroundElevation)
             {
-                if (m_elvCoordinatesGnd.size() > m_maxElevationsGnd) { m_elvCoordinatesGnd.pop_back(); }
-                m_elvCoordinatesGnd.push_front(elevationCoordinate);
+                m_elvCoordinatesGnd.insert(elevationCoordinate, now);
+                m_elvCoordinatesGnd.keepLatest(m_maxElevationsGnd);
             }
             else
             {
-                if (m_elvCoordinates.size() > m_maxElevations) { m_elvCoordinates.pop_back(); }
-                m_elvCoordinates.push_front(elevationCoordinate);
+                m_elvCoordinates.insert(elevationCoordinate, now);
+                m_elvCoordinates.keepLatest(m_maxElevations);
             }
 
             // statistics
@@ -271,54 +269,48 @@ namespace BlackMisc::Simulation
     CCoordinateGeodeticList ISimulationEnvironmentProvider::getAllElevationCoordinates() const
     {
         QReadLocker l(&m_lockElvCoordinates);
-        CCoordinateGeodeticList cl(m_elvCoordinatesGnd);
-        cl.push_back(m_elvCoordinates);
+        CCoordinateGeodeticList cl(m_elvCoordinatesGnd.toList());
+        cl.push_back(m_elvCoordinates.toList());
         return cl;
     }
 
     CCoordinateGeodeticList ISimulationEnvironmentProvider::getElevationCoordinatesOnGround() const
     {
         QReadLocker l(&m_lockElvCoordinates);
-        return m_elvCoordinatesGnd;
+        return m_elvCoordinatesGnd.toList();
     }
 
     CElevationPlane ISimulationEnvironmentProvider::averageElevationOfOnGroundAircraft(const CAircraftSituation &reference, const CLength &range, int minValues, int sufficientValues) const
     {
-        const CCoordinateGeodeticList coordinates = this->getElevationCoordinatesOnGround();
+        CCoordinateGeodeticList coordinates;
+        {
+            QReadLocker l(&m_lockElvCoordinates);
+            if (m_elvCoordinatesGnd.size() < minValues) { return CElevationPlane::null(); } // no chance to succeed
+            coordinates = m_elvCoordinatesGnd.findWithinRange(reference, range);
+        }
         return coordinates.averageGeodeticHeight(reference, range, CAircraftSituation::allowedAltitudeDeviation(), minValues, sufficientValues);
     }
 
     CAltitude ISimulationEnvironmentProvider::highestElevation() const
     {
-        const CCoordinateGeodeticList coordinates = this->getElevationCoordinatesOnGround();
-        if (coordinates.isEmpty()) { return CAltitude::null(); }
-        return coordinates.findMaxHeight();
+        QReadLocker l(&m_lockElvCoordinates);
+        return m_elvCoordinatesGnd.findMaxHeight();
     }
 
     CCoordinateGeodeticList ISimulationEnvironmentProvider::getAllElevationCoordinates(int &maxRemembered) const
     {
         QReadLocker l(&m_lockElvCoordinates);
         maxRemembered = m_maxElevations;
-        CCoordinateGeodeticList cl(m_elvCoordinatesGnd);
-        cl.push_back(m_elvCoordinates);
+        CCoordinateGeodeticList cl(m_elvCoordinatesGnd.toList());
+        cl.push_back(m_elvCoordinates.toList());
         return cl;
     }
 
     int ISimulationEnvironmentProvider::cleanUpElevations(const ICoordinateGeodetic &referenceCoordinate, int maxNumber)
     {
-        int currentMax;
-        CCoordinateGeodeticList coordinates(this->getAllElevationCoordinates(currentMax));
-        if (maxNumber < 0) { maxNumber = currentMax; }
-        const int size = coordinates.size();
-        if (size <= maxNumber) { return 0; }
-        coordinates.sortByEuclideanDistanceSquared(referenceCoordinate);
-        coordinates.truncate(maxNumber);
-        const int delta = size - coordinates.size();
-        {
-            QWriteLocker l(&m_lockElvCoordinates);
-            m_elvCoordinates = coordinates;
-        }
-        return delta;
+        QWriteLocker l(&m_lockElvCoordinates);
+        if (maxNumber < 0) { maxNumber = m_maxElevations; }
+        return m_elvCoordinates.keepClosest(maxNumber, referenceCoordinate);
     }
 
     CElevationPlane ISimulationEnvironmentProvider::findClosestElevationWithinRange(const ICoordinateGeodetic &reference, const CLength &range) const
@@ -327,10 +319,22 @@ namespace BlackMisc::Simulation
 
         // for single point we use a slightly optimized version
         const bool singlePoint = (&range == &CElevationPlane::singlePointRadius() || range.isNull() || range <= CElevationPlane::singlePointRadius());
-        const CCoordinateGeodeticList elevations = this->getAllElevationCoordinates();
-        const CCoordinateGeodetic coordinate = singlePoint ?
-                                                elevations.findFirstWithinRangeOrDefault(reference, CElevationPlane::singlePointRadius()) :
-                                                elevations.findClosestWithinRange(reference, range);
+        CCoordinateGeodetic coordinate;
+        {
+            // only grid cells overlapping the range are searched, "on ground" elevations first
+            QReadLocker l(&m_lockElvCoordinates);
+            if (singlePoint)
+            {
+                coordinate = m_elvCoordinatesGnd.findFirstWithinRangeOrDefault(reference, CElevationPlane::singlePointRadius());
+                if (coordinate.isNull()) { coordinate = m_elvCoordinates.findFirstWithinRangeOrDefault(reference, CElevationPlane::singlePointRadius()); }
+            }
+            else
+            {
+                coordinate = m_elvCoordinatesGnd.findClosestWithinRange(reference, range);
+                const CCoordinateGeodetic closest = m_elvCoordinates.findClosestWithinRange(reference, range);
+                if (coordinate.isNull() || (!closest.isNull() && reference.calculateGreatCircleDistance(closest) < reference.calculateGreatCircleDistance(coordinate))) { coordinate = closest; }
+            }
+        }
         const bool found = !coordinate.isNull();
 
         {
@@ -386,8 +390,8 @@ namespace BlackMisc::Simulation
         int elv;
         {
             QReadLocker l(&m_lockElvCoordinates);
-            elvGnd = m_elvCoordinatesGnd.sizeInt();
-            elv    = m_elvCoordinates.sizeInt();
+            elvGnd = m_elvCoordinatesGnd.size();
+            elv    = m_elvCoordinates.size();
         }
         return info.arg(f).arg(m).arg(QString::number(hitRatioPercent, 'f', 1)).arg(elv).arg(elvGnd);
     }
@@ -561,43 +565,16 @@ namespace BlackMisc::Simulation
         if (reference.isNull() || keptRange.isNull()) { return false; }
         const CLength r = minRange(keptRange);
 
-        CCoordinateGeodeticList cleanedKeptElvs;
-        bool maxReached = false;
-        bool cleaned    = false;
-
-        {
-            QReadLocker l(&m_lockElvCoordinates);
-            cleanedKeptElvs = m_elvCoordinates;
-            maxReached = m_elvCoordinates.size() >= m_maxElevations;
-        }
-        if (!cleanedKeptElvs.isEmpty() && (forced || maxReached))
-        {
-            const int removed = cleanedKeptElvs.removeOutsideRange(reference, r);
-            if (removed > 0)
-            {
-                cleaned = true;
-                QWriteLocker l(&m_lockElvCoordinates);
-                m_elvCoordinates = cleanedKeptElvs;
-            }
-        }
-
-        cleanedKeptElvs.clear();
+        bool cleaned = false;
+        QWriteLocker l(&m_lockElvCoordinates);
+        if (!m_elvCoordinates.isEmpty() && (forced || m_elvCoordinates.size() >= m_maxElevations))
         {
-            QReadLocker l(&m_lockElvCoordinates);
-            cleanedKeptElvs = m_elvCoordinatesGnd;
-            maxReached = m_elvCoordinatesGnd.size() >= m_maxElevationsGnd;
+            cleaned = m_elvCoordinates.removeOutsideRange(reference, r) > 0;
         }
-        if (!cleanedKeptElvs.isEmpty() && (forced || maxReached))
+        if (!m_elvCoordinatesGnd.isEmpty() && (forced || m_elvCoordinatesGnd.size() >= m_maxElevationsGnd))
         {
-            const int removed = cleanedKeptElvs.removeOutsideRange(reference, r);
-            if (removed > 0)
-            {
-                cleaned = true;
-                QWriteLocker l(&m_lockElvCoordinates);
-                m_elvCoordinatesGnd = cleanedKeptElvs;
-            }
+            cleaned = m_elvCoordinatesGnd.removeOutsideRange(reference, r) > 0 || cleaned;
         }
-
         return cleaned;
     }
 
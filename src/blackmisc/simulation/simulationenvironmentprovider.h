@@ -18,6 +18,7 @@
 #include "blackmisc/aviation/percallsign.h"
 #include "blackmisc/geo/coordinategeodeticlist.h"
 #include "blackmisc/geo/elevationplane.h"
+#include "blackmisc/geo/coordinategeodeticgrid.h"
 #include "blackmisc/pq/length.h"
 #include "blackmisc/provider.h"
 
@@ -222,7 +223,7 @@ namespace BlackMisc::Simulation
         //! \threadsafe
         void clearSimulationEnvironmentData();
 
-        //! Only keep closest ones
+        //! Only keep closest ones (of the not "on ground" elevations)
         //! \threadsafe
         int cleanUpElevations(const Geo::ICoordinateGeodetic &referenceCoordinate, int maxNumber = -1);
 
@@ -291,8 +292,8 @@ namespace BlackMisc::Simulation
         // idea: the elevations on gnd are likely taxiways and runways, so we keep those
         int m_maxElevations    = 100;   //!< How many elevations we keep
         int m_maxElevationsGnd = 400;   //!< How many elevations we keep for elevations on gnd.
-        Geo::CCoordinateGeodeticList    m_elvCoordinates;    //!< elevation cache
-        Geo::CCoordinateGeodeticList    m_elvCoordinatesGnd; //!< elevation cache for on ground situations
+        Geo::CCoordinateGeodeticGrid    m_elvCoordinates;    //!< elevation cache
+        Geo::CCoordinateGeodeticGrid    m_elvCoordinatesGnd; //!< elevation cache for on ground situations
 
         Aviation::CTimestampPerCallsign m_pendingElevationRequests; //!< pending elevation requests for aircraft callsign
         Aviation::CLengthPerCallsign    m_cgsPerCallsign;           //!< CGs per callsign
@@ -19,7 +19,12 @@
 #include <QObject>
 #include <QMetaObject>
 #include <QSharedPointer>
+#include <QtGlobal>
+#include <condition_variable>
 #include <functional>
+#include <future>
+#include <mutex>
+#include <vector>
 
 namespace BlackMisc
 {
@@ -46,6 +51,71 @@ namespace BlackMisc
         return promise.future();
     }
 
+    /*!
+     * Number of chunks to split size elements into, one chunk per thread with at least minSizePerChunk elements.
+     * \remark 1 means the elements are not worth to be processed concurrently
+     */
+    inline int parallelChunkCount(int size, int minSizePerChunk)
+    {
+        return qBound(1, qMin(QThread::idealThreadCount(), size / qMax(1, minSizePerChunk)), 16);
+    }
+
+    /*!
+     * Calls task(chunk, from, to) for each of the chunks of the range [0, size) and waits until all are done.
+     *
+     * A single chunk is processed in the calling thread, otherwise each chunk concurrently by std::async.
+     * Each task must only write to data of its own chunk.
+     * \remark progress is called in the calling thread with the number of processed elements as soon as a chunk is done
+     */
+    template <typename F>
+    void forEachChunkParallel(int size, int chunks, F &&task, const std::function<void(int)> &progress = {})
+    {
+        if (size < 1) { return; }
+        const int chunk = (size + qMax(1, chunks) - 1) / qMax(1, chunks);
+        if (chunk >= size)
+        {
+            task(0, 0, size);
+            if (progress) { progress(size); }
+            return;
+        }
+
+        // the calling thread only waits, and reports the progress whenever a chunk is done
+        std::mutex mutex;
+        std::condition_variable chunkDone;
+        int processed = 0;
+        const auto setChunkDone = [&](int count)
+        {
+            { std::lock_guard<std::mutex> lock(mutex); processed += count; }
+            chunkDone.notify_one();
+        };
+
+        std::vector<std::future<void>> futures;
+        for (int c = 0; c * chunk < size; ++c)
+        {
+            const int from = c * chunk;
+            const int to = qMin(from + chunk, size);
+            futures.push_back(std::async(std::launch::async, [&task, &setChunkDone, c, from, to]
+            {
+                try { task(c, from, to); }
+                catch (...) { setChunkDone(to - from); throw; }
+                setChunkDone(to - from);
+            }));
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        for (int reported = 0; reported < size;)
+        {
+            chunkDone.wait(lock, [&] { return processed > reported; });
+            reported = processed;
+            if (!progress) { continue; }
+            lock.unlock();
+            progress(reported);
+            lock.lock();
+        }
+        lock.unlock();
+        for (std::future<void> &future : futures) { future.get(); } // rethrows exceptions of the tasks
+    }
+
     /*!
      * Utility class for threaded operations
      */
@@ -372,6 +372,24 @@ namespace BlackMisc
         }
         for (auto it = namespaces.cbegin(); it != namespaces.cend(); ++it)
         {
+            const QString binaryFileName = dir + "/" + it.key() + ".bin";
+            const BinaryFormat binaryFormat = it->size() == 1 ? getBinaryFormat(it->cbegin().key()) : BinaryFormat();
+            if (binaryFormat.toBinary)
+            {
+                // a Json file of the value is kept for older versions sharing the directory
+                CAtomicFile file(binaryFileName);
+                if (! QDir::root().mkpath(QFileInfo(file).path()))
+                {
+                    return CStatusMessage(this).error(u"Failed to create directory '%1'") << QFileInfo(file).path();
+                }
+                const QByteArray data = binaryFormat.toBinary(it->cbegin().value());
+                if (!(file.open(QFile::WriteOnly) && file.write(data) == data.size() && file.checkedClose()))
+                {
+                    return CStatusMessage(this).error(u"Failed to write to %1: %2") << file.fileName() << file.errorString();
+                }
+                continue;
+            }
+
             CAtomicFile file(dir + "/" + it.key() + ".json");
             if (! QDir::root().mkpath(QFileInfo(file).path()))
             {
@@ -393,6 +411,7 @@ namespace BlackMisc
             {
                 return CStatusMessage(this).error(u"Failed to write to %1: %2") << file.fileName() << file.errorString();
             }
+            if (it->contains(it.key())) { QFile::remove(binaryFileName); } // no longer saved in the binary format
         }
         return CStatusMessage(this).info(u"Written '%1' to value cache in '%2'") <<
             (keysMessage.isEmpty() ? values.keys().to<QStringList>().join(",") : keysMessage) << dir;
@@ -419,14 +438,18 @@ namespace BlackMisc
             return CStatusMessage(this).error(u"Failed to read from directory '%1'") << dir;
         }
 
+        // a value in a binary file is loaded from there, its Json file is outdated if there is one
+        const auto hasBinaryFile = [this, &dir](const QString &key) { return isBinaryFormat(key) && QFile::exists(QDir(dir).absoluteFilePath(key + ".bin")); };
+
         QMap<QString, QStringList> keysInFiles;
         for (const auto &key : keys)
         {
-            keysInFiles[key.section('/', 0, m_fileSplitDepth - 1) + ".json"].push_back(key);
+            const QString ns = key.section('/', 0, m_fileSplitDepth - 1);
+            keysInFiles[ns + (hasBinaryFile(key) ? ".bin" : ".json")].push_back(key);
         }
         if (keys.isEmpty())
         {
-            QDirIterator iter(dir, { "*.json" }, QDir::Files, QDirIterator::Subdirectories);
+            QDirIterator iter(dir, { "*.json", "*.bin" }, QDir::Files, QDirIterator::Subdirectories);
             while (iter.hasNext())
             {
                 keysInFiles.insert(QDir(dir).relativeFilePath(iter.next()), {});
@@ -440,6 +463,35 @@ namespace BlackMisc
             {
                 continue;
             }
+            if (it.key().endsWith(".bin"))
+            {
+                const QString key = it.key().chopped(4);
+                CVariantMap temp;
+                if (keysOnly) { temp.insert(key, {}); }
+                else
+                {
+                    const BinaryFormat binaryFormat = getBinaryFormat(key);
+                    if (! binaryFormat.fromBinary) { continue; } // no value using this file
+                    if (! file.open(QFile::ReadOnly))
+                    {
+                        return CStatusMessage(this).error(u"Failed to open %1: %2") << file.fileName() << file.errorString();
+                    }
+                    CStatusMessage status;
+                    const CVariant value = binaryFormat.fromBinary(file.readAll(), status);
+                    file.close();
+                    if (status.isFailure())
+                    {
+                        ok = false;
+                        backupFile(file);
+                        CLogMessage::preformatted(status);
+                        continue;
+                    }
+                    temp.insert(key, value);
+                }
+                temp.removeDuplicates(currentValues);
+                o_values.insert(temp, QFileInfo(file).lastModified().toMSecsSinceEpoch());
+                continue;
+            }
             if (! file.open(QFile::ReadOnly | QFile::Text))
             {
                 return CStatusMessage(this).error(u"Failed to open %1: %2") << file.fileName() << file.errorString();
@@ -467,6 +519,8 @@ namespace BlackMisc
                     CLogMessage::preformatted(messages);
                 }
             }
+            const QString ns = it.key().chopped(5);
+            if (temp.contains(ns) && hasBinaryFile(ns)) { temp.remove(ns); }
             temp.removeDuplicates(currentValues);
             o_values.insert(temp, QFileInfo(file).lastModified().toMSecsSinceEpoch());
         }
@@ -514,7 +568,37 @@ namespace BlackMisc
 
     QString CValueCache::filenameForKey(const QString &key) const
     {
-        return key.section('/', 0, m_fileSplitDepth - 1) + ".json";
+        return key.section('/', 0, m_fileSplitDepth - 1) + (isBinaryFormat(key) ? ".bin" : ".json");
+    }
+
+    void CValueCache::setBinaryFormat(const QString &key, const BinaryFormat &format)
+    {
+        QMutexLocker lock(&m_mutex);
+        m_binaryFormats.insert(key, format);
+    }
+
+    bool CValueCache::isBinaryFormat(const QString &key) const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_binaryFormats.contains(key) && key.section('/', 0, m_fileSplitDepth - 1) == key;
+    }
+
+    CValueCache::BinaryFormat CValueCache::getBinaryFormat(const QString &key) const
+    {
+        QMutexLocker lock(&m_mutex);
+        return isBinaryFormat(key) ? m_binaryFormats.value(key) : BinaryFormat();
+    }
+
+    CVariantMap CValueCache::getValuesToMigrateToBinary(const QString &dir, const CVariantMap &values) const
+    {
+        CVariantMap migrate;
+        for (auto it = values.cbegin(); it != values.cend(); ++it)
+        {
+            if (! isBinaryFormat(it.key())) { continue; }
+            if (QFile::exists(dir + "/" + it.key() + ".bin") || ! QFile::exists(dir + "/" + it.key() + ".json")) { continue; }
+            migrate.insert(it.key(), it.value());
+        }
+        return migrate;
     }
 
     QStringList CValueCache::enumerateFiles(const QString &dir) const
@@ -290,6 +290,23 @@ namespace BlackMisc
         //! \threadsafe
         CStatusMessage loadFromFiles(const QString &directory, const QSet<QString> &keys, const CVariantMap &current, CValueCachePacket &o_values, const QString &keysMessage = {}, bool keysOnly = false) const;
 
+        //! Functions to save a value in a binary file instead of a Json file.
+        struct BinaryFormat
+        {
+            std::function<QByteArray(const CVariant &)> toBinary; //!< binary data of a value
+            std::function<CVariant(const QByteArray &, CStatusMessage &)> fromBinary; //!< value of binary data
+        };
+
+        //! Save the value with the given key in a binary file instead of a Json file.
+        //! Only applies to values whose key is not split into subdirectories,
+        //! values in Json files are copied to binary files when they are loaded.
+        //! \threadsafe
+        void setBinaryFormat(const QString &key, const BinaryFormat &format);
+
+        //! Values loaded from Json files which are to be saved in the binary format, but have no binary file yet.
+        //! \threadsafe
+        CVariantMap getValuesToMigrateToBinary(const QString &directory, const CVariantMap &values) const;
+
         //! Mark all values with keys that start with the given prefix as having been saved.
         //! \threadsafe
         void markAllAsSaved(const QString &keyPrefix);
@@ -321,8 +338,11 @@ namespace BlackMisc
 
         QMap<QString, ElementPtr> m_elements;
         QMap<QString, QString> m_humanReadable;
+        QMap<QString, BinaryFormat> m_binaryFormats; //!< values saved in binary files
         const int m_fileSplitDepth = 1; //!< How many levels of subdirectories to split JSON files
 
+        bool isBinaryFormat(const QString &key) const;
+        BinaryFormat getBinaryFormat(const QString &key) const;
         Element &getElement(const QString &key);
         Element &getElement(const QString &key, QMap<QString, ElementPtr>::const_iterator pos);
         std::tuple<CVariant, qint64, bool> getValue(const QString &key);
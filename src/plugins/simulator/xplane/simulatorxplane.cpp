@@ -1058,9 +1058,12 @@ namespace BlackSimPlugin::XPlane
         PlanesSurfaces planesSurfaces;
         PlanesTransponders planesTransponders;
 
-        int aircraftNumber = 0;
         const bool updateAllAircraft = this->isUpdateAllRemoteAircraft(currentTimestamp);
         const CCallsignSet callsignsInRange = this->getAircraftInRangeCallsigns();
+        QVector<CCallsign> callsigns;
+        QVector<CInterpolatorMulti *> interpolators;
+        callsigns.reserve(m_xplaneAircraftObjects.size());
+        interpolators.reserve(m_xplaneAircraftObjects.size());
         for (const CXPlaneMPAircraft &xplaneAircraft : std::as_const(m_xplaneAircraftObjects))
         {
             const CCallsign callsign(xplaneAircraft.getCallsign());
@@ -1081,11 +1084,16 @@ namespace BlackSimPlugin::XPlane
             planesTransponders.idents.push_back(transponderMode == CTransponder::StateIdent);
             planesTransponders.modeCs.push_back(transponderMode == CTransponder::ModeC);
 
-            // setup
-            const CInterpolationAndRenderingSetupPerCallsign setup = this->getInterpolationSetupConsolidated(callsign, updateAllAircraft);
+            callsigns.push_back(callsign);
+            interpolators.push_back(xplaneAircraft.getInterpolator());
+        }
 
-            // interpolated situation/parts
-            const CInterpolationResult result = xplaneAircraft.getInterpolation(currentTimestamp, setup, aircraftNumber++);
+        // interpolated situations/parts of all aircraft in one pass
+        const QVector<CInterpolationResult> results = this->interpolateRemoteAircraft(callsigns, interpolators, currentTimestamp, updateAllAircraft);
+        for (int i = 0; i < results.size(); ++i)
+        {
+            const CCallsign &callsign = callsigns[i];
+            const CInterpolationResult &result = results[i];
             if (result.getInterpolationStatus().hasValidSituation())
             {
                 CAircraftSituation interpolatedSituation(result);
@@ -1114,7 +1122,7 @@ namespace BlackSimPlugin::XPlane
                 if (updateAllAircraft || !this->isEqualLastSent(parts, callsign))
                 {
                     this->rememberLastSent(parts, callsign);
-                    planesSurfaces.push_back(xplaneAircraft.getCallsign(), parts);
+                    planesSurfaces.push_back(callsign, parts);
                 }
             }
 
@@ -17,6 +17,7 @@ swiftConfig(libs.blackinput) {
 }
 swiftConfig(libs.blackcore) {
     SUBDIRS += blackcore
+    SUBDIRS += swiftdbsnapshot
 }
 swiftConfig(libs.blackgui) {
     SUBDIRS += blackgui
@@ -0,0 +1,42 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+//! Writes the binary snapshots of the bundled DB files, run when swift is installed
+
+#include "blackcore/db/databaseutils.h"
+#include "blackmisc/statusmessagelist.h"
+#include "blackmisc/swiftdirectories.h"
+
+#include <stdlib.h>
+#include <QCoreApplication>
+#include <QIODevice>
+#include <QStringList>
+#include <QTextStream>
+
+using namespace BlackMisc;
+using namespace BlackCore::Db;
+
+//! main
+int main(int argc, char *argv[])
+{
+    // runs at install time, possibly as root, so no swift application (no settings, caches or network)
+    QCoreApplication qa(argc, argv);
+
+    // optional argument: directory of the DB files
+    const QStringList args = qa.arguments();
+    const QString directory = args.size() > 1 ? args.at(1) : CSwiftDirectories::staticDbFilesDirectory();
+
+    QTextStream out(stdout, QIODevice::WriteOnly);
+    const CStatusMessageList msgs = CDatabaseUtils::writeBinaryDbSnapshots(directory);
+    for (const CStatusMessage &msg : msgs)
+    {
+        out << msg.getSeverityAsString() << ": " << msg.getMessage() << Qt::endl;
+    }
+    return msgs.hasErrorMessages() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,33 @@
+load(common_pre)
+
+QT       += core dbus network
+
+TARGET = swiftdbsnapshot
+TEMPLATE = app
+
+CONFIG   += console
+CONFIG   -= app_bundle
+CONFIG   += blackmisc blackcore
+
+DEPENDPATH += . $$SourceRoot/src/blackmisc $$SourceRoot/src/blackcore
+INCLUDEPATH += . $$SourceRoot/src
+
+DESTDIR = $$DestRoot/bin
+
+SOURCES += *.cpp
+
+target.path = $$PREFIX/bin
+INSTALLS += target
+
+# binary snapshots of the installed DB files, written with the installed binary
+# best effort: the Qt libraries are copied by install.pri afterwards, so the binary might not start yet.
+# Errors are ignored ("-"), swift writes a missing snapshot when it reads the bundled models.
+# Not on Windows (missing DLL dialog), macOS (frameworks) or when cross compiling.
+unix:!macx:!cross_compile {
+    dbsnapshot.path = $$PREFIX/share/shared/dbdata
+    dbsnapshot.extra = -$$shell_path($$PREFIX/bin/$$TARGET) $$shell_path($$PREFIX/share/shared/dbdata)
+    dbsnapshot.depends = install_target
+    INSTALLS += dbsnapshot
+}
+
+load(common_post)
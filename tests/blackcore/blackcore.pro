@@ -3,4 +3,5 @@ TEMPLATE = subdirs
 SUBDIRS += \
     context \
     fsd \
+    testaircraftmatcher \
     testconnectivity \
@@ -34,6 +34,7 @@
 #include "blackcore/fsd/clientresponse.h"
 #include "blackcore/fsd/flightplan.h"
 #include "blackcore/fsd/fsdidentification.h"
+#include "blackcore/fsd/fsdline.h"
 #include "blackcore/fsd/serializer.h"
 #include "blackcore/fsd/servererror.h"
 #include "blackcore/fsd/interimpilotdataupdate.h"
@@ -82,6 +83,7 @@ namespace BlackMiscTest
         void testEuroscopeSimData();
         void testFlightPlan();
         void testFSDIdentification();
+        void testFsdLine();
         void testInterimPilotDataUpdate();
         void testKillRequest();
         void testPBH();
@@ -378,6 +380,44 @@ namespace BlackMiscTest
 
     }
 
+    void CTestFsdMessages::testFsdLine()
+    {
+        int prefixLength = 0;
+        QCOMPARE(classifyMessageType("@N:ABCD", 7, prefixLength), MessageType::PilotDataUpdate);
+        QCOMPARE(prefixLength, 1);
+        QCOMPARE(classifyMessageType("#SLABCD", 7, prefixLength), MessageType::VisualPilotDataPeriodic);
+        QCOMPARE(prefixLength, 3);
+        QCOMPARE(classifyMessageType("$!!SERVER", 9, prefixLength), MessageType::KillRequest);
+        QCOMPARE(classifyMessageType("SIMDATA:", 8, prefixLength), MessageType::EuroscopeSimData);
+        QCOMPARE(prefixLength, 7);
+        QCOMPARE(classifyMessageType("!RABCD", 6, prefixLength), MessageType::RegistrationInfo);
+        QCOMPARE(classifyMessageType("#XY", 3, prefixLength), MessageType::Unknown);
+        QCOMPARE(prefixLength, 0);
+
+        const FsdLine line("@N:ABCD:7000:1:43.12578:-72.15841:12000:125:25132146:8\r\n", nullptr);
+        QCOMPARE(line.messageType(), MessageType::PilotDataUpdate);
+        QCOMPARE(line.size(), 10);
+        QCOMPARE(line.toQString(1), QString("ABCD"));
+        QCOMPARE(line.toInt(2), 7000);
+        QCOMPARE(line.toDouble(5), -72.15841);
+        QCOMPARE(line.toUInt(8), 25132146u);
+        QCOMPARE(line.toInt(42), 0);
+        QCOMPARE(line.toTokens(), QString("N:ABCD:7000:1:43.12578:-72.15841:12000:125:25132146:8").split(':'));
+
+        const PilotDataUpdate fromLine = PilotDataUpdate::fromTokens(line);
+        const PilotDataUpdate fromList = PilotDataUpdate::fromTokens(line.toTokens());
+        QCOMPARE(fromLine, fromList);
+
+        const FsdLine emptyTokens("$CRDLH123:BER721::Jon Doe\r\n", nullptr);
+        QCOMPARE(emptyTokens.size(), 4);
+        QCOMPARE(emptyTokens.toQString(2), QString());
+        QCOMPARE(emptyTokens.toTokens(), QString("DLH123:BER721::Jon Doe").split(':'));
+
+        const FsdLine noPayload("#DL \r\n", nullptr);
+        QCOMPARE(noPayload.messageType(), MessageType::ServerHeartbeat);
+        QVERIFY(!noPayload.hasPayload());
+    }
+
     void CTestFsdMessages::testInterimPilotDataUpdate()
     {
         const InterimPilotDataUpdate message("ABCD", "XYZ", 43.12578, -72.15841, 12008, 400, -2, 3, 280, true);
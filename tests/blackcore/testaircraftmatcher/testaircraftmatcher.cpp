@@ -0,0 +1,99 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackcore
+
+#include "blackcore/aircraftmatcher.h"
+#include "blackmisc/simulation/aircraftmatchersetup.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/simulatedaircraft.h"
+#include "blackmisc/simulation/simulatorinfo.h"
+#include "blackmisc/aviation/aircraftcategorylist.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/network/user.h"
+#include "blackmisc/statusmessagelist.h"
+#include "test.h"
+
+#include <QObject>
+#include <QTest>
+
+using namespace BlackCore;
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Network;
+using namespace BlackMisc::Simulation;
+
+namespace BlackCoreTest
+{
+    //! Test the matching steps of BlackCore::CAircraftMatcher
+    class CTestAircraftMatcher : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Glider reduced by category in getClosestMatch
+        void categoryMatching();
+
+    private:
+        //! Category with level
+        static CAircraftCategory category(const QString &name, int l1, int l2, int dbKey);
+
+        //! Model with aircraft ICAO code of category
+        static CAircraftModel model(const QString &modelString, const QString &icao, const CAircraftCategory &category);
+    };
+
+    void CTestAircraftMatcher::categoryMatching()
+    {
+        const CAircraftCategory airplane = category("Airplane", 1, 0, 1);
+        const CAircraftCategory glider = category("Glider", 5, 0, 2);
+        const CAircraftCategory twoSeater = category("Two seater", 5, 1, 3);
+
+        // without categories the first model is picked
+        const CAircraftModelList modelSet({ model("C172 Skyhawk", "C172", airplane), model("Schleicher ASK21", "AS21", twoSeater) });
+        const CAircraftModel remoteModel = model(QString(), "AS21", twoSeater);
+        const CSimulatedAircraft remoteAircraft(CCallsign("DEKAB"), remoteModel, CUser(), CAircraftSituation());
+
+        CAircraftMatcher matcher(CAircraftMatcherSetup(CAircraftMatcherSetup::MatchingStepwiseReduce, CAircraftMatcherSetup::ByCategoryGlider, CAircraftMatcherSetup::PickFirst));
+        matcher.setModelSet(modelSet, CSimulatorInfo::xplane(), true);
+
+        CAircraftModel matched = matcher.getClosestMatch(remoteAircraft, MatchingLogNothing, nullptr, false);
+        QCOMPARE(matched.getModelString(), QString("C172 Skyhawk"));
+
+        matcher.setCategories(CAircraftCategoryList({ airplane, glider, twoSeater }));
+        CStatusMessageList log;
+        matched = matcher.getClosestMatch(remoteAircraft, MatchingLogAll, &log, false);
+        QCOMPARE(matched.getModelString(), QString("Schleicher ASK21"));
+        QVERIFY2(log.toSingleMessage().getMessage().contains("by category"), "Expect category reduction in log");
+    }
+
+    CAircraftCategory CTestAircraftMatcher::category(const QString &name, int l1, int l2, int dbKey)
+    {
+        CAircraftCategory c(name, name, QString(), true);
+        c.setLevel(l1, l2, 0);
+        c.setDbKey(dbKey);
+        return c;
+    }
+
+    CAircraftModel CTestAircraftMatcher::model(const QString &modelString, const QString &icao, const CAircraftCategory &category)
+    {
+        CAircraftIcaoCode icaoCode(icao);
+        icaoCode.setCategory(category);
+        return CAircraftModel(modelString, CAircraftModel::TypeOwnSimulatorModel, icaoCode, CLivery());
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackCoreTest::CTestAircraftMatcher);
+
+#include "testaircraftmatcher.moc"
+
+//! \endcond
@@ -13,6 +13,7 @@
 #include "blackcore/application.h"
 #include "blackcore/data/globalsetup.h"
 #include "blackcore/db/airportdatareader.h"
+#include "blackcore/db/databaseutils.h"
 #include "blackcore/db/icaodatareader.h"
 #include "blackcore/db/modeldatareader.h"
 #include "blackmisc/aviation/aircrafticaocode.h"
@@ -24,10 +25,14 @@
 #include "blackmisc/network/networkutils.h"
 #include "blackmisc/simulation/aircraftmodel.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/fileutils.h"
+#include "blackmisc/swiftdirectories.h"
 #include "test.h"
 
 #include <QDateTime>
 #include <QDebug>
+#include <QFile>
+#include <QTemporaryDir>
 #include <QTest>
 #include <QString>
 #include <QtDebug>
@@ -56,6 +61,9 @@ namespace BlackCoreTest
         //! Read model data
         void readModelData();
 
+        //! Binary snapshot of the bundled models
+        void binaryModelSnapshot();
+
         //! Read airport data
         void readAirportData();
 
@@ -154,6 +162,53 @@ namespace BlackCoreTest
         CApplication::processEventsFor(2500); // make sure events are processed
     }
 
+    void CTestReaders::binaryModelSnapshot()
+    {
+        const QString bundled = CFileUtils::appendFilePaths(CSwiftDirectories::staticDbFilesDirectory(), "models.json");
+        if (!QFile::exists(bundled)) { QSKIP("No bundled models."); return; }
+
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString modelsFile = dir.filePath("models.json");
+        QVERIFY(QFile::copy(bundled, modelsFile));
+
+        CStatusMessage status;
+        QVERIFY(CDatabaseUtils::readBinaryModelSnapshot(modelsFile, status).isEmpty());
+        QVERIFY(!status.isFailure());
+
+        const CStatusMessageList msgs = CDatabaseUtils::writeBinaryDbSnapshots(dir.path());
+        QVERIFY2(!msgs.hasErrorMessages(), qUtf8Printable(msgs.toQString()));
+        QVERIFY(QFile::exists(CDatabaseUtils::binaryModelSnapshotFileName(modelsFile)));
+
+        const CAircraftModelList models = CDatabaseUtils::readBinaryModelSnapshot(modelsFile, status);
+        QVERIFY2(status.isSuccess(), qUtf8Printable(status.getMessage()));
+        const CAircraftModelList expected = CAircraftModelList::fromMultipleJsonFormats(CDatabaseUtils::readQJsonObjectFromDatabaseFile(modelsFile));
+        QVERIFY(!expected.isEmpty());
+        QCOMPARE(models, expected);
+
+        // a changed models file of the same size invalidates the newer snapshot
+        QFile changed(modelsFile);
+        QVERIFY(changed.open(QIODevice::ReadWrite));
+        QByteArray content = changed.readAll();
+        content[content.size() - 1] = content.endsWith(' ') ? '\n' : ' ';
+        QVERIFY(changed.seek(0) && changed.write(content) == content.size());
+        changed.close();
+        QFile snapshot(CDatabaseUtils::binaryModelSnapshotFileName(modelsFile));
+        QVERIFY(snapshot.open(QIODevice::ReadOnly));
+        QVERIFY(snapshot.setFileTime(QDateTime::currentDateTimeUtc().addSecs(3600), QFileDevice::FileModificationTime));
+        snapshot.close();
+        QVERIFY(CDatabaseUtils::readBinaryModelSnapshot(modelsFile, status).isEmpty());
+        QCOMPARE(status.getSeverity(), CStatusMessage::SeverityWarning);
+
+        // written again from the models already read, without models file it can not be checked
+        const CStatusMessage written = CDatabaseUtils::writeBinaryModelSnapshot(modelsFile, expected, CDatabaseUtils::binaryModelSnapshotFileName(modelsFile));
+        QVERIFY2(written.isSuccess(), qUtf8Printable(written.getMessage()));
+        QCOMPARE(CDatabaseUtils::readBinaryModelSnapshot(modelsFile, status), expected);
+        QVERIFY(QFile::remove(modelsFile));
+        QVERIFY(CDatabaseUtils::readBinaryModelSnapshot(modelsFile, status).isEmpty());
+        QCOMPARE(status.getSeverity(), CStatusMessage::SeverityWarning);
+    }
+
     void CTestReaders::readAirportData()
     {
         using namespace BlackMisc::Geo;
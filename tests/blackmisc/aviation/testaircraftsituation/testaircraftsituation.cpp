@@ -13,6 +13,7 @@
 #include "blackconfig/buildconfig.h"
 #include "blackmisc/aviation/aircraftsituationchange.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
+#include "blackmisc/aviation/aircraftsituationrunningstatistics.h"
 #include "blackmisc/network/fsdsetup.h"
 #include "blackmisc/cputime.h"
 // #include "blackmisc/math/mathutils.h"
@@ -55,6 +56,9 @@ namespace BlackMiscTest
         //! Rotating up aircraft
         void rotateUp();
 
+        //! Running statistics vs. list based change
+        void runningStatistics();
+
         //! Test sort order
         void sortOrder() const;
 
@@ -153,6 +157,39 @@ namespace BlackMiscTest
         QVERIFY2(change2.isRotatingUp(), "Expect rotate up");
     }
 
+    void CTestAircraftSituation::runningStatistics()
+    {
+        const CAircraftSituationList situations = testSituations(); // latest first
+        const int maxElements = 6;
+        CAircraftSituationList window;
+        CAircraftSituationRunningStatistics statistics;
+        for (int i = situations.size() - 1; i >= 0; --i)
+        {
+            window.push_frontMaxElements(situations[i], maxElements);
+            statistics.addLatest(situations[i], maxElements);
+        }
+        QVERIFY2(statistics.size() == window.size(), "Expect same size");
+
+        const CAircraftSituationChange change(window, cg(), false, true, true);
+        const CAircraftSituationChange runningChange(window, statistics, cg(), false);
+        QVERIFY2(runningChange.isConstAscending(), "Expect ascending");
+        QVERIFY(runningChange.isConstAscending() == change.isConstAscending());
+        QVERIFY(runningChange.isConstDescending() == change.isConstDescending());
+        QVERIFY(runningChange.containsPushBack() == change.containsPushBack());
+
+        const CAltitudePair alt = change.getAltitudeStdDevAndMean();
+        const CAltitudePair runningAlt = runningChange.getAltitudeStdDevAndMean();
+        QVERIFY2(qAbs(alt.first.value(CLengthUnit::m()) - runningAlt.first.value(CLengthUnit::m())) < 0.001, "Expect same altitude std.deviation");
+        QVERIFY2(qAbs(alt.second.value(CLengthUnit::m()) - runningAlt.second.value(CLengthUnit::m())) < 0.001, "Expect same altitude mean");
+
+        CAircraftSituationRunningStatistics rebuilt;
+        QVERIFY(!rebuilt.isValid());
+        rebuilt.rebuild(window);
+        QVERIFY(rebuilt.isValid());
+        const CAltitudePair rebuiltAlt = rebuilt.altitudeStandardDeviationAndMean();
+        QVERIFY2(qAbs(rebuiltAlt.second.value(CLengthUnit::m()) - runningAlt.second.value(CLengthUnit::m())) < 0.001, "Expect same mean after rebuild");
+    }
+
     void CTestAircraftSituation::sortOrder() const
     {
         CAircraftSituationList situations = testSituations();
@@ -16,6 +16,7 @@
 #include "blackmisc/aviation/altitude.h"
 #include "blackmisc/aviation/atcstation.h"
 #include "blackmisc/aviation/callsign.h"
+#include "blackmisc/aviation/callsignid.h"
 #include "blackmisc/aviation/callsignset.h"
 #include "blackmisc/aviation/comsystem.h"
 #include "blackmisc/aviation/heading.h"
@@ -38,6 +39,8 @@
 #include <QDateTime>
 #include <QString>
 #include <QTest>
+#include <QVector>
+#include <thread>
 
 using namespace BlackMisc::Aviation;
 using namespace BlackMisc::PhysicalQuantities;
@@ -67,6 +70,9 @@ namespace BlackMiscTest
         //! Callsigns and callsign containers
         void callsignWithContainers();
 
+        //! Interned callsign identifiers
+        void callsignIds();
+
         //! Testing copying and equality of objects
         void copyAndEqual();
 
@@ -212,6 +218,46 @@ namespace BlackMiscTest
         QVERIFY2(set.size() == 0, "Last should be gone");
     }
 
+    void CTestAviation::callsignIds()
+    {
+        const CCallsign cs1("EDDM_TWR");
+        const CCallsign cs2("eddm_twr");
+        const CCallsign cs3("DLH123");
+
+        const CCallsignId id1(cs1);
+        QVERIFY2(!id1.isEmpty(), "Callsign shall have an identifier");
+        QVERIFY2(id1 == CCallsignId(cs2), "Equal callsigns shall have the same identifier");
+        QVERIFY2(id1 != CCallsignId(cs3), "Different callsigns shall have different identifiers");
+        QVERIFY2(id1.toCallsign() == cs1, "Identifier shall map back to callsign");
+
+        const int interned = CCallsignId::internedCount();
+        QVERIFY2(CCallsignId(cs2) == id1 && CCallsignId::internedCount() == interned, "Known callsign shall not be interned again");
+
+        QVERIFY2(CCallsignId(CCallsign()).isEmpty(), "Empty callsign shall have the empty identifier");
+        QVERIFY2(CCallsignId(CCallsign()) == CCallsignId(), "Empty identifiers shall be equal");
+        QVERIFY2(CCallsignId().toCallsign().isEmpty(), "Empty identifier shall map to empty callsign");
+
+        QHash<CCallsignId, int> hash;
+        hash.insert(id1, 1);
+        hash.insert(CCallsignId(cs3), 3);
+        QVERIFY2(hash.value(CCallsignId(cs2)) == 1, "Identifier shall be usable as hash key");
+
+        // interned by another thread, and more callsigns than fit in one block of the intern table
+        QVector<CCallsignId> threadIds;
+        std::thread([&]
+        {
+            threadIds.push_back(CCallsignId(cs2));
+            for (int i = 0; i < 300; ++i) { threadIds.push_back(CCallsignId(CCallsign(QStringLiteral("TST%1").arg(i)))); }
+        }).join();
+        QVERIFY2(threadIds.front() == id1, "Identifier shall be the same in all threads");
+        for (int i = 0; i < 300; ++i)
+        {
+            const CCallsign cs(QStringLiteral("tst%1").arg(i));
+            QVERIFY2(CCallsignId(cs) == threadIds[i + 1], "Identifier of another thread shall be found");
+            QVERIFY2(threadIds[i + 1].toCallsign() == cs, "Identifier of another thread shall map back to callsign");
+        }
+    }
+
     void CTestAviation::copyAndEqual()
     {
         const CFrequency f1(123.45, CFrequencyUnit::MHz());
@@ -10,15 +10,24 @@
 //! \file
 //! \ingroup testblackmisc
 
+#include "blackmisc/aviation/atcstationlist.h"
 #include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/geo/coordinategeodeticgrid.h"
+#include "blackmisc/geo/coordinategeodeticlist.h"
+#include "blackmisc/geo/geoobjectindex.h"
+#include "blackmisc/geo/greatcirclekernel.h"
 #include "blackmisc/geo/earthangle.h"
 #include "blackmisc/geo/latitude.h"
 #include "blackmisc/pq/physicalquantity.h"
 #include "blackmisc/pq/units.h"
 #include "test.h"
 
+#include <QRandomGenerator>
 #include <QTest>
+#include <array>
+#include <cmath>
 
+using namespace BlackMisc::Aviation;
 using namespace BlackMisc::Geo;
 using namespace BlackMisc::PhysicalQuantities;
 using namespace BlackMisc::Math;
@@ -36,6 +45,15 @@ namespace BlackMiscTest
 
         //! CCoordinateGeodetic unit tests
         void coordinateGeodetic();
+
+        //! CCoordinateGeodeticGrid finds the same coordinates as CCoordinateGeodeticList
+        void coordinateGeodeticGrid();
+
+        //! CGeoObjectIndex finds the same objects as the indexed list
+        void geoObjectIndex();
+
+        //! Batch great circle kernel calculates the same distances and bearings as the single coordinate functions
+        void greatCircleKernel();
     };
 
     void CTestGeo::geoBasics()
@@ -79,6 +97,151 @@ namespace BlackMiscTest
         latValue = testCoordinate.latitude().value(CAngleUnit::deg());
         QCOMPARE(latValue, newLat.value(CAngleUnit::deg()));
     }
+
+    void CTestGeo::coordinateGeodeticGrid()
+    {
+        // coordinates around an airport, some far away and around the date line, latest first like the elevation cache
+        QRandomGenerator rng(4711);
+        CCoordinateGeodeticList list;
+        CCoordinateGeodeticGrid grid;
+        for (int i = 0; i < 500; ++i)
+        {
+            const double lat = (i % 50 == 0) ? rng.bounded(160.0) - 80.0 : 50.03 + rng.bounded(0.1) - 0.05;
+            const double lon = (i % 50 == 0) ? rng.bounded(360.0) - 180.0 : (i % 10 == 0) ? 179.99 + rng.bounded(0.02) : 8.57 + rng.bounded(0.1) - 0.05;
+            const CCoordinateGeodetic c(lat, lon, rng.bounded(500.0));
+            list.push_front(c);
+            grid.insert(c, i);
+        }
+        QCOMPARE(grid.size(), list.sizeInt());
+        QCOMPARE(grid.toList(), list);
+        QCOMPARE(grid.findMaxHeight(), list.findMaxHeight());
+
+        const CCoordinateGeodetic eddf(50.03, 8.57, 0.0);
+        const CCoordinateGeodetic dateLine(50.03, -179.999, 0.0);
+        const CCoordinateGeodetic northPole(89.999, 0.0, 0.0);
+        for (const CCoordinateGeodetic &reference : { eddf, dateLine, northPole, list.back() })
+        {
+            for (double rangeM : { 1.0, 50.0, 500.0, 2500.0, 100000.0, 20000000.0 })
+            {
+                const CLength range(rangeM, CLengthUnit::m());
+                QCOMPARE(grid.findWithinRange(reference, range), list.findWithinRange(reference, range));
+                QCOMPARE(grid.findFirstWithinRangeOrDefault(reference, range), list.findFirstWithinRangeOrDefault(reference, range));
+                QCOMPARE(grid.findClosestWithinRange(reference, range), list.findClosestWithinRange(reference, range));
+            }
+            for (int number : { 1, 5, 50, 1000 })
+            {
+                QCOMPARE(grid.findClosest(number, reference).sizeInt(), qMin(number, list.sizeInt()));
+                QCOMPARE(grid.findClosest(number, reference).back().calculateGreatCircleDistance(reference), list.findClosest(number, reference).back().calculateGreatCircleDistance(reference));
+            }
+        }
+
+        // eviction by distance and age
+        CCoordinateGeodeticGrid copy(grid);
+        CCoordinateGeodeticList copyList(list);
+        const CLength range(2500.0, CLengthUnit::m());
+        QCOMPARE(copy.removeOutsideRange(eddf, range), copyList.removeOutsideRange(eddf, range));
+        QCOMPARE(copy.toList(), copyList);
+        QCOMPARE(copy.removeInsideRange(eddf, CLength(500.0, CLengthUnit::m())), copyList.removeInsideRange(eddf, CLength(500.0, CLengthUnit::m())));
+        QCOMPARE(copy.toList(), copyList);
+
+        copy = grid;
+        QCOMPARE(copy.keepClosest(10, eddf), grid.size() - 10);
+        QCOMPARE(copy.findClosest(10, eddf), grid.findClosest(10, eddf));
+
+        copy = grid;
+        copyList = list;
+        copyList.truncate(100);
+        QCOMPARE(copy.keepLatest(100), grid.size() - 100);
+        QCOMPARE(copy.toList(), copyList);
+        copyList.truncate(50);
+        QCOMPARE(copy.removeOlderThan(450), 50);
+        QCOMPARE(copy.toList(), copyList);
+    }
+
+    void CTestGeo::geoObjectIndex()
+    {
+        // spread over the globe like airports, some close to each other
+        QRandomGenerator rng(815);
+        CCoordinateGeodeticList list;
+        for (int i = 0; i < 5000; ++i)
+        {
+            const double lat = (i % 2 == 0) ? rng.bounded(180.0) - 90.0 : 50.0 + rng.bounded(2.0);
+            const double lon = (i % 2 == 0) ? rng.bounded(360.0) - 180.0 : 8.0 + rng.bounded(2.0);
+            list.push_back(CCoordinateGeodetic(lat, lon, 0.0));
+        }
+
+        const CGeoObjectIndex<CCoordinateGeodeticList> index(list);
+        QVERIFY2(index.isIndexOf(list), "Expect shared copy to be indexed");
+        QVERIFY2(!index.isIndexOf(CCoordinateGeodeticList(list.findClosest(10, list.front()))), "Expect other list not to be indexed");
+
+        for (const CCoordinateGeodetic &reference : { CCoordinateGeodetic(50.03, 8.57, 0.0), CCoordinateGeodetic(-89.9, 0.0, 0.0), CCoordinateGeodetic(0.0, 180.0, 0.0), list[42] })
+        {
+            for (double rangeM : { 0.0, 1000.0, 25000.0, 500000.0, 25000000.0 })
+            {
+                const CLength range(rangeM, CLengthUnit::m());
+                QCOMPARE(index.findWithinRange(reference, range), list.findWithinRange(reference, range));
+                const CCoordinateGeodetic closest = index.findClosestWithinRange(reference, range);
+                const CCoordinateGeodetic closestList = list.findClosestWithinRange(reference, range);
+                QCOMPARE(closest.isNull(), closestList.isNull());
+                if (!closest.isNull()) { QVERIFY(qAbs(closest.calculateGreatCircleDistance(reference).value(CLengthUnit::m()) - closestList.calculateGreatCircleDistance(reference).value(CLengthUnit::m())) < 1.0); }
+            }
+            for (int number : { 1, 10, 100, 10000 })
+            {
+                const CCoordinateGeodeticList closest = index.findClosest(number, reference);
+                const CCoordinateGeodeticList closestList = list.findClosest(number, reference);
+                QCOMPARE(closest.size(), closestList.size());
+                for (int i = 0; i < closest.sizeInt(); ++i)
+                {
+                    // same distance, equal distances may be in a different order
+                    QVERIFY(qAbs(calculateEuclideanDistanceSquared(closest[i], reference) - calculateEuclideanDistanceSquared(closestList[i], reference)) < 1.0e-6);
+                }
+            }
+        }
+    }
+
+    void CTestGeo::greatCircleKernel()
+    {
+        QRandomGenerator rng(4711);
+        CAtcStationList stations;
+        QVector<std::array<double, 3>> vectors;
+        for (int i = 0; i < 1001; ++i)
+        {
+            CAtcStation station;
+            station.setCallsign(CCallsign(QStringLiteral("EDDF%1_TWR").arg(i)));
+            if (i != 7) { station.setPosition(CCoordinateGeodetic(rng.bounded(180.0) - 90.0, rng.bounded(360.0) - 180.0, 0.0)); } // one without position
+            stations.push_back(station);
+            vectors.push_back(station.normalVectorDouble());
+        }
+
+        const CCoordinateGeodetic reference(50.03, 8.57, 0.0);
+        QVector<double> distances(vectors.size());
+        QVector<double> bearings(vectors.size());
+        QVector<double> distancesScalar(vectors.size());
+        QVector<double> bearingsScalar(vectors.size());
+        calculateGreatCircleDistancesAndBearings(reference.normalVectorDouble(), vectors.constData(), vectors.size(), distances.data(), bearings.data());
+        calculateGreatCircleDistancesAndBearingsScalar(reference.normalVectorDouble(), vectors.constData(), vectors.size(), distancesScalar.data(), bearingsScalar.data());
+        QCOMPARE(distances, distancesScalar);
+        QCOMPARE(bearings, bearingsScalar);
+
+        // float precision of calculateGreatCircleDistance and calculateBearing
+        CAtcStationList updated(stations);
+        updated.calculcateAndUpdateRelativeDistanceAndBearing(reference);
+        for (int i = 0; i < stations.sizeInt(); ++i)
+        {
+            const CLength distance = calculateGreatCircleDistance(stations[i], reference);
+            const CAngle bearing = calculateBearing(stations[i], reference);
+            QCOMPARE(updated[i].getRelativeDistance().isNull(), distance.isNull());
+            QCOMPARE(updated[i].getRelativeBearing().isNull(), bearing.isNull());
+            if (distance.isNull()) { continue; }
+            QVERIFY(qAbs(updated[i].getRelativeDistance().value(CLengthUnit::m()) - distance.value(CLengthUnit::m())) < 10.0);
+            QVERIFY(qAbs(std::remainder(updated[i].getRelativeBearing().value(CAngleUnit::rad()) - bearing.value(CAngleUnit::rad()), 2 * M_PI)) < 1.0e-4); // +-180deg
+        }
+
+        // distances only, bearings are kept
+        updated.calculcateAndUpdateRelativeDistance(CCoordinateGeodetic(-33.9, 151.2, 0.0));
+        QVERIFY(qAbs(updated[0].getRelativeDistance().value(CLengthUnit::m()) - calculateGreatCircleDistance(stations[0], CCoordinateGeodetic(-33.9, 151.2, 0.0)).value(CLengthUnit::m())) < 10.0);
+        QCOMPARE(updated[0].getRelativeBearing(), CAngle(bearings[0], CAngleUnit::rad()));
+    }
 } // ns
 
 //! main
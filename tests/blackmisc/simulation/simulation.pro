@@ -1,5 +1,8 @@
 TEMPLATE = subdirs
 SUBDIRS += \
+    testaircraftmodellistbinary \
+    testaircraftmodelsetindex \
+    testairspaceaircraftsnapshot \
     testinterpolatorlinear \
     testinterpolatormisc \
     testinterpolatorparts \
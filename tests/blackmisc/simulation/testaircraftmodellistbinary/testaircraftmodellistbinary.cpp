@@ -0,0 +1,208 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/aircraftmodellistbinary.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/distributor.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/airlineicaocode.h"
+#include "blackmisc/aviation/livery.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/units.h"
+#include "test.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! Binary model list tests
+    class CTestAircraftModelListBinary : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Models converted to binary and back are equal
+        void roundTrip();
+
+        //! Single models and model strings
+        void lazyAccess();
+
+        //! Corrupted data are detected
+        void corrupted();
+
+        //! Memory mapped file
+        void mappedFile();
+
+    private:
+        //! Test models
+        static CAircraftModelList testModels();
+
+        //! Compare also the members not used for comparison
+        static void compareModels(const CAircraftModelList &models, const CAircraftModelList &expected);
+    };
+
+    void CTestAircraftModelListBinary::roundTrip()
+    {
+        const CAircraftModelList models = testModels();
+        const QByteArray data = CAircraftModelListBinary::toBinary(models);
+        QVERIFY(CAircraftModelListBinary::isBinary(data));
+        QVERIFY(!CAircraftModelListBinary::isBinary(models.toJsonString().toUtf8()));
+
+        CAircraftModelListBinary binary(data);
+        QVERIFY(!binary.isValid());
+        QVERIFY(binary.validate().isSuccess());
+        QVERIFY(binary.isValid());
+        QCOMPARE(binary.size(), models.sizeInt());
+        compareModels(binary.toAircraftModelList(), models);
+
+        CStatusMessage status;
+        compareModels(CAircraftModelListBinary::fromBinary(data, status), models);
+        QVERIFY(status.isSuccess());
+
+        CAircraftModelListBinary empty(CAircraftModelListBinary::toBinary({}));
+        QVERIFY(empty.validate().isSuccess());
+        QCOMPARE(empty.size(), 0);
+        QVERIFY(empty.toAircraftModelList().isEmpty());
+    }
+
+    void CTestAircraftModelListBinary::lazyAccess()
+    {
+        const CAircraftModelList models = testModels();
+        CAircraftModelListBinary binary(CAircraftModelListBinary::toBinary(models));
+        QVERIFY(binary.validate().isSuccess());
+
+        for (int i = 0; i < models.sizeInt(); ++i)
+        {
+            QCOMPARE(binary.getModelString(i), models[i].getModelString());
+        }
+        const int last = models.sizeInt() - 1;
+        CAircraftModelList accessed;
+        accessed.push_back(binary.getModel(last));
+        accessed.push_back(binary.getModel(0));
+        CAircraftModelList expected;
+        expected.push_back(models[last]);
+        expected.push_back(models[0]);
+        compareModels(accessed, expected);
+        QVERIFY(binary.getModelString(models.sizeInt()).isEmpty());
+        QVERIFY(binary.getModel(-1).getModelString().isEmpty());
+    }
+
+    void CTestAircraftModelListBinary::corrupted()
+    {
+        const QByteArray data = CAircraftModelListBinary::toBinary(testModels());
+        for (int position : { data.size() / 2, data.size() - 1 })
+        {
+            QByteArray corrupted(data);
+            corrupted[position] = static_cast<char>(corrupted[position] ^ 0x55);
+            CAircraftModelListBinary binary(corrupted);
+            QVERIFY(binary.validate().isFailure());
+            QVERIFY(!binary.isValid());
+            QCOMPARE(binary.size(), 0);
+            QVERIFY(binary.toAircraftModelList().isEmpty());
+        }
+
+        CAircraftModelListBinary truncated(data.left(data.size() - 1));
+        QVERIFY(truncated.validate().isFailure());
+
+        CAircraftModelListBinary json(testModels().toJsonString().toUtf8());
+        QVERIFY(json.validate().isFailure());
+
+        CStatusMessage status;
+        QVERIFY(CAircraftModelListBinary::fromBinary(data.left(data.size() / 2), status).isEmpty());
+        QVERIFY(status.isFailure());
+    }
+
+    void CTestAircraftModelListBinary::mappedFile()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString fileName = dir.filePath("models.bin");
+        const CAircraftModelList models = testModels();
+        {
+            QFile file(fileName);
+            QVERIFY(file.open(QFile::WriteOnly));
+            QVERIFY(file.write(CAircraftModelListBinary::toBinary(models)) > 0);
+        }
+
+        CStatusMessage status;
+        compareModels(CAircraftModelListBinary::fromFile(fileName, status), models);
+        QVERIFY(status.isSuccess());
+
+        CAircraftModelListBinary binary;
+        QVERIFY(binary.mapFile(fileName).isSuccess());
+        QCOMPARE(binary.getModelString(1), models[1].getModelString());
+
+        CAircraftModelListBinary::fromFile(dir.filePath("missing.bin"), status);
+        QVERIFY(status.isFailure());
+    }
+
+    CAircraftModelList CTestAircraftModelListBinary::testModels()
+    {
+        const CAircraftIcaoCode b738("B738", "", "B737", "L2J", "BOEING", "", "", "", "M", true, false, false, 0);
+        const CAircraftIcaoCode a320("A320", "", "A320", "L2J", "AIRBUS", "", "", "", "M", true, false, false, 0);
+        const CDistributor distributor("FSX", "Microsoft", "MS", "", CSimulatorInfo::FSX);
+
+        CAircraftModelList models;
+        int key = 1;
+        for (const CAircraftIcaoCode &icao : { b738, a320 })
+        {
+            for (const QString &airline : { "DLH", "BAW" })
+            {
+                const CLivery livery(airline + ".STD", CAirlineIcaoCode(airline), "standard");
+                CAircraftModel model(QStringLiteral("%1 %2").arg(icao.getDesignator(), airline), CAircraftModel::TypeOwnSimulatorModel, icao, livery);
+                model.setDbKey(key++);
+                model.setMSecsSinceEpoch(1600000000000 + key);
+                model.setSimulator(CSimulatorInfo::FSX);
+                model.setDistributor(distributor);
+                model.setDescription(QStringLiteral("Description %1 ä").arg(airline));
+                model.setFileName(QStringLiteral("C:/Sim/SimObjects/%1/aircraft.cfg").arg(icao.getDesignator()));
+                model.setFileTimestamp(1500000000000);
+                model.setCG(CLength(3.5, CLengthUnit::ft()));
+                models.push_back(model);
+            }
+        }
+
+        CAircraftModel excluded("C172 EXCLUDED", CAircraftModel::TypeManuallySet);
+        excluded.setModelMode(CAircraftModel::Exclude);
+        excluded.setModelStringAlias("alias c172");
+        excluded.setCallsign(CCallsign("DAMBZ"));
+        models.push_back(excluded);
+        return models;
+    }
+
+    void CTestAircraftModelListBinary::compareModels(const CAircraftModelList &models, const CAircraftModelList &expected)
+    {
+        QCOMPARE(models, expected);
+        for (int i = 0; i < models.sizeInt(); ++i)
+        {
+            QCOMPARE(models[i].getDescription(), expected[i].getDescription());
+            QCOMPARE(models[i].getFileName(), expected[i].getFileName());
+            QCOMPARE(models[i].getFileTimestamp(), expected[i].getFileTimestamp());
+            QCOMPARE(models[i].getCG(), expected[i].getCG());
+            QCOMPARE(models[i].getCG().getUnit(), expected[i].getCG().getUnit());
+        }
+    }
+} // namespace
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestAircraftModelListBinary);
+
+#include "testaircraftmodellistbinary.moc"
+
+//! \endcond
@@ -0,0 +1,172 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/aircraftmodelsetindex.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/airlineicaocode.h"
+#include "blackmisc/aviation/livery.h"
+#include "test.h"
+
+#include <QTest>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! Model set index tests
+    class CTestAircraftModelSetIndex : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Index returns the same models as searching the list
+        void sameAsList();
+
+        //! Index is only used for the indexed list
+        void isIndexOf();
+
+        //! Best scored models are the highest scored models of full scoring
+        void scoreBest();
+
+    private:
+        //! Test models
+        static CAircraftModelList testModels();
+    };
+
+    void CTestAircraftModelSetIndex::sameAsList()
+    {
+        const CAircraftModelList models = testModels();
+        const CAircraftModelSetIndex index(models);
+        QCOMPARE(index.size(), models.sizeInt());
+
+        for (const QString &aircraft : { "B738", "A320", "A319", "C172", "XXXX", "" })
+        {
+            for (const QString &airline : { "DLH", "BAW", "EZY", "" })
+            {
+                const CAircraftIcaoCode aircraftIcao(aircraft);
+                const CAirlineIcaoCode airlineIcao(airline);
+                QCOMPARE(index.findByIcaoDesignators(aircraftIcao, airlineIcao).getModelStringList(false), models.findByIcaoDesignators(aircraftIcao, airlineIcao).getModelStringList(false));
+
+                const QString livery = airline.isEmpty() ? QString() : airline + ".STD";
+                QCOMPARE(index.findByAircraftDesignatorAndLiveryCombinedCode(aircraft, livery).getModelStringList(false), models.findByAircraftDesignatorAndLiveryCombinedCode(aircraft, livery).getModelStringList(false));
+                QCOMPARE(index.findByAircraftDesignatorAndLiveryCombinedCode(aircraft.toLower(), livery.toLower()).getModelStringList(false), models.findByAircraftDesignatorAndLiveryCombinedCode(aircraft.toLower(), livery.toLower()).getModelStringList(false));
+            }
+        }
+
+        for (const QString &family : { "A320", "B737", "a320", "C172", "" })
+        {
+            QCOMPARE(index.findByFamily(family).getModelStringList(false), models.findByFamily(family).getModelStringList(false));
+        }
+
+        for (const QString &manufacturer : { "Boeing", "BOEING", "Airbus", "Cessna", "" })
+        {
+            QCOMPARE(index.findByManufacturer(manufacturer).getModelStringList(false), models.findByManufacturer(manufacturer).getModelStringList(false));
+        }
+
+        for (const QString &combinedType : { "L2J", "l2j", "L1P", "L*J", "L-J", "**P", "L2", "" })
+        {
+            QCOMPARE(index.findByCombinedType(combinedType).getModelStringList(false), models.findByCombinedType(combinedType).getModelStringList(false));
+        }
+
+        for (const CAircraftIcaoCode &icao : { CAircraftIcaoCode("B738", "L2J", "Boeing", "", "M", true, false, false, 0), CAircraftIcaoCode("C172", "L1P", "CESSNA", "", "L", true, false, false, 0), CAircraftIcaoCode("A320", "L2J") })
+        {
+            QCOMPARE(index.findByCombinedAndManufacturer(icao).getModelStringList(false), models.findByCombinedAndManufacturer(icao).getModelStringList(false));
+        }
+
+        for (const QString &modelString : { "B738 DLH 1", "b738 dlh 1", "ALIAS A320", "unknown", "" })
+        {
+            QCOMPARE(index.findFirstByModelStringAliasOrDefault(modelString).getModelString(), models.findFirstByModelStringAliasOrDefault(modelString).getModelString());
+        }
+    }
+
+    void CTestAircraftModelSetIndex::isIndexOf()
+    {
+        const CAircraftModelList models = testModels();
+        const CAircraftModelSetIndex index(models);
+
+        CAircraftModelList copy(models);
+        QVERIFY2(index.isIndexOf(copy), "Expect shared copy to be indexed");
+
+        copy.removeIfExcluded(); // nothing to remove
+        QVERIFY2(index.isIndexOf(copy), "Expect unmodified copy to be indexed");
+
+        copy.push_back(CAircraftModel("NEW", CAircraftModel::TypeOwnSimulatorModel));
+        QVERIFY2(!index.isIndexOf(copy), "Expect modified copy not to be indexed");
+        QVERIFY2(!index.isIndexOf(testModels()), "Expect equal, but other list not to be indexed");
+    }
+
+    void CTestAircraftModelSetIndex::scoreBest()
+    {
+        // large enough to be scored in parallel
+        CAircraftModelList models;
+        const CAircraftModelList m = testModels();
+        while (models.size() < 5000) { models.push_back(m); }
+
+        const CAircraftIcaoCode a320("A320", "", "A320", "L2J", "AIRBUS", "", "", "", "M", true, false, false, 0);
+        const CAircraftIcaoCode c152("C152", "", "", "L1P", "CESSNA", "", "", "", "L", true, false, false, 0);
+        for (const CAircraftIcaoCode &icao : { a320, c152, CAircraftIcaoCode() })
+        {
+            for (const QString &airline : { "DLH", "AFR", "" })
+            {
+                const CLivery livery = airline.isEmpty() ? CLivery() : CLivery(airline + ".STD", CAirlineIcaoCode(airline), "standard");
+                const CAircraftModel remote("REMOTE", CAircraftModel::TypeQueriedFromNetwork, icao, livery);
+                for (bool ignoreZeroScores : { true, false })
+                {
+                    const ScoredModels full = models.scoreFull(remote, false, ignoreZeroScores);
+                    int scored = -1;
+                    const ScoredModels best = models.scoreBest(remote, false, ignoreZeroScores, &scored);
+                    QCOMPARE(scored, full.size());
+                    QCOMPARE(best.isEmpty(), full.isEmpty());
+                    if (full.isEmpty()) { continue; }
+                    QCOMPARE(best.firstKey(), full.lastKey());
+                    QCOMPARE(best.lastKey(), full.lastKey());
+                    QCOMPARE(CAircraftModelList(best.values()).getModelStringList(false), CAircraftModelList(full.values(full.lastKey())).getModelStringList(false));
+                }
+            }
+        }
+    }
+
+    CAircraftModelList CTestAircraftModelSetIndex::testModels()
+    {
+        const CAircraftIcaoCode b738("B738", "", "B737", "L2J", "BOEING", "", "", "", "M", true, false, false, 0);
+        const CAircraftIcaoCode a320("A320", "", "A320", "L2J", "AIRBUS", "", "", "", "M", true, false, false, 0);
+        const CAircraftIcaoCode a319("A319", "", "A320", "L2J", "AIRBUS", "", "", "", "M", true, false, false, 0);
+        const CAircraftIcaoCode c172("C172", "", "", "L1P", "CESSNA", "", "", "", "L", true, false, false, 0);
+
+        CAircraftModelList models;
+        for (const CAircraftIcaoCode &icao : { b738, a320, a319, c172 })
+        {
+            for (const QString &airline : { "DLH", "BAW", "EZY" })
+            {
+                const CLivery livery(airline + ".STD", CAirlineIcaoCode(airline), "standard");
+                for (int i = 1; i <= 2; ++i)
+                {
+                    models.push_back(CAircraftModel(QStringLiteral("%1 %2 %3").arg(icao.getDesignator(), airline).arg(i), CAircraftModel::TypeOwnSimulatorModel, icao, livery));
+                }
+            }
+        }
+
+        CAircraftModel aliased("A320 ALIASED", CAircraftModel::TypeOwnSimulatorModel, a320, CLivery());
+        aliased.setModelStringAlias("alias a320");
+        models.push_back(aliased);
+        return models;
+    }
+} // namespace
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestAircraftModelSetIndex);
+
+#include "testaircraftmodelsetindex.moc"
+
+//! \endcond
@@ -0,0 +1,156 @@
+/* Copyright (C) 2021
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/airspaceaircraftsnapshot.h"
+#include "blackmisc/simulation/simulatedaircraftlist.h"
+#include "blackmisc/simulation/aircraftmodel.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/callsignset.h"
+#include "blackmisc/pq/units.h"
+#include "test.h"
+
+#include <QRandomGenerator>
+#include <QTest>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! Airspace aircraft snapshot tests
+    class CTestAirspaceAircraftSnapshot : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Restricted snapshot enables the closest enabled aircraft
+        void restricted();
+
+        //! Incremental snapshot is the same as a new snapshot
+        void incremental();
+
+    private:
+        //! Test aircraft
+        static CSimulatedAircraftList testAircraft(int number, QRandomGenerator &rng);
+
+        //! Expected enabled aircraft, closest first up to max. aircraft and distance
+        static CCallsignSet expectedEnabled(const CSimulatedAircraftList &aircraft, int maxAircraft, const CLength &maxDistance);
+
+        //! Same callsign sets?
+        static void compareSnapshots(const CAirspaceAircraftSnapshot &snapshot, const CAirspaceAircraftSnapshot &expected);
+    };
+
+    void CTestAirspaceAircraftSnapshot::restricted()
+    {
+        QRandomGenerator rng(1234);
+        const CSimulatedAircraftList aircraft = testAircraft(300, rng);
+        const CLength maxDistance(50.0, CLengthUnit::km());
+
+        const CAirspaceAircraftSnapshot unrestricted(aircraft, false, true, 20, maxDistance);
+        QCOMPARE(unrestricted.getAircraftCallsignsByDistance().size(), aircraft.size());
+        QCOMPARE(unrestricted.getEnabledAircraftCallsignsByDistance(), aircraft.findByEnabled(true).getCallsigns());
+        QCOMPARE(unrestricted.getVtolAircraftCallsignsByDistance(), aircraft.findByVtol(true).getCallsigns());
+
+        const CAirspaceAircraftSnapshot snapshot(aircraft, true, true, 20, maxDistance);
+        QCOMPARE(snapshot.getEnabledAircraftCallsignsByDistance(), expectedEnabled(aircraft, 20, maxDistance));
+        QCOMPARE(snapshot.getEnabledAircraftCallsignsByDistance().size() + snapshot.getDisabledAircraftCallsignsByDistance().size(), aircraft.size());
+        QCOMPARE(snapshot.getEnabledVtolAircraftCallsignsByDistance(), snapshot.getEnabledAircraftCallsignsByDistance().intersection(aircraft.findByVtol(true).getCallsigns()));
+        QCOMPARE(snapshot.getReRankedAircraftCount(), aircraft.size());
+        QVERIFY2(!snapshot.isIncremental(), "Expect full snapshot");
+
+        const CAirspaceAircraftSnapshot notRendering(aircraft, true, false, 20, maxDistance);
+        QVERIFY(notRendering.getEnabledAircraftCallsignsByDistance().isEmpty());
+        QCOMPARE(notRendering.getDisabledAircraftCallsignsByDistance().size(), aircraft.size());
+    }
+
+    void CTestAirspaceAircraftSnapshot::incremental()
+    {
+        QRandomGenerator rng(4321);
+        CSimulatedAircraftList aircraft = testAircraft(300, rng);
+        const CLength maxDistance(50.0, CLengthUnit::km());
+        CAirspaceAircraftSnapshot previous(aircraft, true, true, 20, maxDistance);
+
+        for (int cycle = 0; cycle < 20; ++cycle)
+        {
+            // some aircraft move, some leave and some join
+            for (CSimulatedAircraft &a : aircraft)
+            {
+                if (rng.bounded(10) == 0) { a.setRelativeDistance(CLength(rng.bounded(100.0), CLengthUnit::km())); }
+            }
+            aircraft.removeIf([&](const CSimulatedAircraft &) { return rng.bounded(50) == 0; });
+            CSimulatedAircraftList joining = testAircraft(5, rng);
+            for (CSimulatedAircraft &a : joining) { a.setCallsign(CCallsign(QStringLiteral("NEW%1%2").arg(cycle).arg(a.getCallsignAsString()))); }
+            aircraft.push_back(joining);
+
+            const CAirspaceAircraftSnapshot snapshot(aircraft, previous, true, true, 20, maxDistance);
+            compareSnapshots(snapshot, CAirspaceAircraftSnapshot(aircraft, true, true, 20, maxDistance));
+            QCOMPARE(snapshot.getEnabledAircraftCallsignsByDistance(), expectedEnabled(aircraft, 20, maxDistance));
+            QVERIFY2(snapshot.isIncremental(), "Expect incremental snapshot");
+            QCOMPARE(snapshot.getPreviousMSecsSinceEpoch(), previous.getMSecsSinceEpoch());
+            QVERIFY2(snapshot.getReRankedAircraftCount() < aircraft.size() / 2, "Expect only moved and new aircraft to be ranked again");
+            previous = snapshot;
+        }
+
+        // restrictions changed, ranking is kept
+        const CAirspaceAircraftSnapshot unrestricted(aircraft, previous, false, true, 20, maxDistance);
+        compareSnapshots(unrestricted, CAirspaceAircraftSnapshot(aircraft, false, true, 20, maxDistance));
+        QCOMPARE(unrestricted.getReRankedAircraftCount(), 0);
+    }
+
+    CSimulatedAircraftList CTestAirspaceAircraftSnapshot::testAircraft(int number, QRandomGenerator &rng)
+    {
+        CSimulatedAircraftList aircraft;
+        for (int i = 0; i < number; ++i)
+        {
+            CAircraftModel model;
+            model.setAircraftIcaoCode(CAircraftIcaoCode(i % 7 == 0 ? "UHEL" : "B738"));
+            CSimulatedAircraft a(model);
+            a.setCallsign(CCallsign(QStringLiteral("DLH%1").arg(i)));
+            a.setEnabled(i % 5 != 0);
+            a.setRendered(i % 3 == 0);
+            if (i % 11 != 0) { a.setRelativeDistance(CLength(i % 13 == 0 ? 10.0 : rng.bounded(100.0), CLengthUnit::km())); } // some same distances, some unknown
+            aircraft.push_back(a);
+        }
+        return aircraft;
+    }
+
+    CCallsignSet CTestAirspaceAircraftSnapshot::expectedEnabled(const CSimulatedAircraftList &aircraft, int maxAircraft, const CLength &maxDistance)
+    {
+        CSimulatedAircraftList sorted(aircraft);
+        sorted.sortByDistanceToReferencePositionRenderedCallsign();
+        CCallsignSet enabled;
+        for (const CSimulatedAircraft &a : std::as_const(sorted))
+        {
+            if (enabled.size() >= maxAircraft) { break; }
+            if (!a.isEnabled() || a.getRelativeDistance().isNull() || a.getRelativeDistance() >= maxDistance) { continue; }
+            enabled.push_back(a.getCallsign());
+        }
+        return enabled;
+    }
+
+    void CTestAirspaceAircraftSnapshot::compareSnapshots(const CAirspaceAircraftSnapshot &snapshot, const CAirspaceAircraftSnapshot &expected)
+    {
+        QCOMPARE(snapshot.getAircraftCallsignsByDistance(), expected.getAircraftCallsignsByDistance());
+        QCOMPARE(snapshot.getEnabledAircraftCallsignsByDistance(), expected.getEnabledAircraftCallsignsByDistance());
+        QCOMPARE(snapshot.getDisabledAircraftCallsignsByDistance(), expected.getDisabledAircraftCallsignsByDistance());
+        QCOMPARE(snapshot.getVtolAircraftCallsignsByDistance(), expected.getVtolAircraftCallsignsByDistance());
+        QCOMPARE(snapshot.getEnabledVtolAircraftCallsignsByDistance(), expected.getEnabledVtolAircraftCallsignsByDistance());
+    }
+} // namespace
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestAirspaceAircraftSnapshot);
+
+#include "testairspaceaircraftsnapshot.moc"
+
+//! \endcond
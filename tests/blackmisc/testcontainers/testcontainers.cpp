@@ -18,18 +18,30 @@
 #include "blackmisc/aviation/aircraftsituationlist.h"
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/aviation/callsignset.h"
+#include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/aircrafticaocodelist.h"
+#include "blackmisc/aviation/airlineicaocode.h"
+#include "blackmisc/aviation/livery.h"
+#include "blackmisc/aviation/liverylist.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/distributor.h"
 #include "blackmisc/collection.h"
 #include "blackmisc/dictionary.h"
 #include "blackmisc/iterator.h"
+#include "blackmisc/memotable.h"
 #include "blackmisc/range.h"
 #include "blackmisc/registermetadata.h"
 #include "blackmisc/sequence.h"
 #include "blackmisc/math/mathutils.h"
 #include "test.h"
 
+#include <QByteArray>
+#include <QDataStream>
 #include <QDateTime>
+#include <QJsonArray>
 #include <QJsonObject>
 #include <QList>
+#include <QMap>
 #include <QSet>
 #include <QString>
 #include <QTest>
@@ -46,6 +58,7 @@ using namespace BlackMisc::Aviation;
 using namespace BlackMisc::Geo;
 using namespace BlackMisc::Math;
 using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
 
 namespace BlackMiscTest
 {
@@ -62,6 +75,11 @@ namespace BlackMiscTest
         void initTestCase();
 
         void collectionBasics();
+        void flatCollection();
+        void memoTable();
+        void memoizedJson();
+        void databaseJson();
+        void replaceOrAddByKey();
         void sequenceBasics();
         void joinAndSplit();
         void findTests();
@@ -96,6 +114,196 @@ namespace BlackMiscTest
         QVERIFY2(c1 == c2, "Copied collection is equal");
     }
 
+    void CTestContainers::flatCollection()
+    {
+        // CCallsignSet is stored in a QFlatOrderedSet
+        CCallsignSet set({ CCallsign("DLH123"), CCallsign("AFR1"), CCallsign("BAW9"), CCallsign("afr1") });
+        QVERIFY2(set.size() == 3, "Equal elements are stored once");
+        QVERIFY2(set.contains(CCallsign("AFR1")) && !set.contains(CCallsign("UAL5")), "Membership");
+        QVERIFY2(std::is_sorted(set.begin(), set.end()), "Iteration is ordered");
+
+        set.insert(CCallsign("EZY7"));
+        set.insert(CCallsign("AAL2"));
+        set.insert(CCallsign("ZZZ1"));
+        QVERIFY2(set.size() == 6 && std::is_sorted(set.begin(), set.end()), "Insert keeps order");
+        set.remove(CCallsign("EZY7"));
+        QVERIFY2(set.size() == 5 && !set.contains(CCallsign("EZY7")), "Removed");
+        QVERIFY2(set.removeIf([](const CCallsign &cs) { return cs.asString().startsWith('A'); }) == 2, "Removed by predicate");
+        QVERIFY2(set == CCallsignSet({ CCallsign("BAW9"), CCallsign("DLH123"), CCallsign("ZZZ1") }), "Remaining elements");
+
+        const CCallsignSet other({ CCallsign("DLH123"), CCallsign("KLM4") });
+        QVERIFY2(set.intersection(other) == CCallsignSet(CCallsign("DLH123")), "Intersection");
+        QVERIFY2(set.difference(other).size() == 2, "Difference");
+        QVERIFY2(set.makeUnion(other).size() == 4, "Union");
+
+        // same data stream format as the QMap based storage
+        QByteArray data;
+        {
+            QDataStream out(&data, QIODevice::WriteOnly);
+            out << static_cast<const CCollection<CCallsign> &>(set);
+        }
+        QMap<CCallsign, CCallsign> map;
+        {
+            QDataStream in(data);
+            in >> map;
+        }
+        QVERIFY2(map.size() == set.size() && map.keys() == set.toQList(), "Readable as QMap");
+        CCollection<CCallsign> read;
+        {
+            QDataStream in(data);
+            in >> read;
+        }
+        QVERIFY2(read == set, "Data stream round trip");
+    }
+
+    void CTestContainers::memoTable()
+    {
+        const CLivery livery("DLH.STD", CAirlineIcaoCode("DLH"), "standard");
+        CLivery dbLivery(livery);
+        dbLivery.setDbKey(1);
+        CLivery sameKey("BAW.STD", CAirlineIcaoCode("BAW"), "standard");
+        sameKey.setDbKey(1);
+
+        CMemoTable<CLivery> liveries;
+        QCOMPARE(liveries.getIndex(livery), 0);
+        QCOMPARE(liveries.getIndex(dbLivery), 1);
+        QCOMPARE(liveries.getIndex(sameKey), 2);
+        QCOMPARE(liveries.getIndex(dbLivery), 1);
+        QCOMPARE(liveries.getIndex(livery), 0);
+        QCOMPARE(liveries.getIndex(sameKey), 2);
+        QCOMPARE(liveries.getTable(), CSequence<CLivery>({ livery, dbLivery, sameKey }));
+
+        CMemoTable<CCallsign> callsigns;
+        QCOMPARE(callsigns.getIndex(CCallsign("DLH123")), 0);
+        QCOMPARE(callsigns.getIndex(CCallsign("BAW1")), 1);
+        QCOMPARE(callsigns.getIndex(CCallsign("DLH123")), 0);
+
+        // merged tables of consecutive chunks are the tables memoized in one go
+        using Helper = CMemoHelper<CLivery, CCallsign>;
+        const QList<CCallsign> values { CCallsign("A1"), CCallsign("B1"), CCallsign("A1"), CCallsign("C1"), CCallsign("B1"), CCallsign("D1") };
+        Helper::CMemoizer all, first, second, merged;
+        for (int i = 0; i < values.size(); ++i)
+        {
+            all.maybeMemoize(values[i]);
+            (i < 3 ? first : second).maybeMemoize(values[i]);
+        }
+        all.maybeMemoize(livery);
+        second.maybeMemoize(livery);
+        merged.mergeTables(first);
+        merged.mergeTables(second);
+        QCOMPARE(merged.getTable<CCallsign>(), all.getTable<CCallsign>());
+        QCOMPARE(merged.getTable<CLivery>(), all.getTable<CLivery>());
+    }
+
+    void CTestContainers::memoizedJson()
+    {
+        // large enough to be memoized in parallel chunks
+        const CAircraftIcaoCode b738("B738", "", "B737", "L2J", "BOEING", "", "", "", "M", true, false, false, 0);
+        const CAircraftIcaoCode a320("A320", "", "A320", "L2J", "AIRBUS", "", "", "", "M", true, false, false, 0);
+        CAircraftModelList models;
+        for (int i = 0; i < 20000; ++i)
+        {
+            const QString airline = QStringLiteral("A%1").arg(i % 97, 2, 10, QChar('0'));
+            CLivery livery(airline + ".STD", CAirlineIcaoCode(airline), "standard");
+            livery.setDbKey(i % 97);
+            CAircraftModel model(QStringLiteral("MODEL %1").arg(i), CAircraftModel::TypeDatabaseEntry, i % 3 ? b738 : a320, livery);
+            model.setDistributor(CDistributor(QStringLiteral("D%1").arg(i % 5)));
+            models.push_back(model);
+        }
+
+        // sequentially memoized
+        CAircraftModel::MemoHelper::CMemoizer helper;
+        QJsonArray array;
+        for (const CAircraftModel &model : std::as_const(models)) { array << model.toMemoizedJson(helper); }
+
+        const QJsonObject json = models.toMemoizedJson();
+        QCOMPARE(json.value("containerbase").toArray(), array);
+        QCOMPARE(json.value("aircraftIcaos").toObject(), helper.getTable<CAircraftIcaoCode>().toJson());
+        QCOMPARE(json.value("liveries").toObject(), helper.getTable<CLivery>().toJson());
+        QCOMPARE(json.value("distributors").toObject(), helper.getTable<CDistributor>().toJson());
+
+        CAircraftModelList read;
+        read.convertFromMemoizedJson(json);
+        QVERIFY2(read == models, "Memoized JSON round trip");
+    }
+
+    void CTestContainers::databaseJson()
+    {
+        // large enough to be converted in parallel chunks, referenced objects taken from the prebuilt lists
+        CAircraftIcaoCodeList icaos;
+        for (const QString &designator : { "B738", "A320", "C172" })
+        {
+            CAircraftIcaoCode icao(designator, "", designator, "L2J", "MANUFACTURER", "", "", "", "M", true, false, false, 0);
+            icao.setDbKey(icaos.sizeInt() + 1);
+            icaos.push_back(icao);
+        }
+        CLiveryList liveries;
+        for (int i = 0; i < 97; ++i)
+        {
+            const QString airline = QStringLiteral("A%1").arg(i, 2, 10, QChar('0'));
+            CLivery livery(airline + ".STD", CAirlineIcaoCode(airline), "standard");
+            livery.setDbKey(i + 1);
+            liveries.push_back(livery);
+        }
+
+        constexpr int n = 20000;
+        QJsonArray array;
+        for (int i = 0; i < n; ++i)
+        {
+            QJsonObject json;
+            json.insert("mod_id", i + 1);
+            json.insert("mod_modelstring", QStringLiteral("MODEL %1").arg(i));
+            json.insert("ac_id", i % 3 + 1);
+            json.insert("liv_id", i % 97 + 1);
+            array.append(json);
+        }
+
+        QVector<int> progress;
+        const CAircraftModelList models = CAircraftModelList::fromDatabaseJsonCaching(array, icaos, {}, liveries, {}, [&](int number) { progress.push_back(number); });
+        QCOMPARE(models.sizeInt(), n);
+        QVERIFY2(!progress.isEmpty() && progress.last() == n, "Progress ends with all models");
+        QVERIFY2(std::is_sorted(progress.cbegin(), progress.cend()), "Progress increases");
+        for (int i = 0; i < n; ++i)
+        {
+            const CAircraftModel &model = models[i];
+            QCOMPARE(model.getModelString(), QStringLiteral("MODEL %1").arg(i));
+            QCOMPARE(model.getAircraftIcaoCode(), icaos[i % 3]);
+            QCOMPARE(model.getLivery(), liveries[i % 97]);
+        }
+    }
+
+    void CTestContainers::replaceOrAddByKey()
+    {
+        const auto livery = [](int key, const QString &description)
+        {
+            CLivery l(QStringLiteral("L%1.STD").arg(key), CAirlineIcaoCode("DLH"), description);
+            if (key >= 0) { l.setDbKey(key); }
+            return l;
+        };
+
+        CLiveryList liveries({ livery(1, "one"), livery(2, "two"), livery(3, "three"), livery(2, "two again"), livery(-1, "no key") });
+        const CLiveryList incremental({ livery(2, "two updated"), livery(3, "three"), livery(4, "four"), livery(-1, "no key, new") });
+
+        int updated = -1;
+        int added = -1;
+        int removed = -1;
+        const int c = liveries.replaceOrAddObjectsByKey(incremental, &updated, &added, &removed);
+        QCOMPARE(updated, 1);
+        QCOMPARE(added, 2);
+        QCOMPARE(removed, 1);
+        QCOMPARE(c, 3);
+        QCOMPARE(liveries, CLiveryList({ livery(1, "one"), livery(2, "two updated"), livery(3, "three"), livery(-1, "no key"), livery(4, "four"), livery(-1, "no key, new") }));
+
+        // nothing changed
+        QCOMPARE(liveries.replaceOrAddObjectsByKey(CLiveryList({ livery(4, "four") }), &updated, &added, &removed), 0);
+        QCOMPARE(updated + added + removed, 0);
+
+        CLiveryList empty;
+        QCOMPARE(empty.replaceOrAddObjectsByKey(incremental, &updated, &added, &removed), incremental.sizeInt());
+        QCOMPARE(added, incremental.sizeInt());
+        QCOMPARE(empty, incremental);
+    }
+
     void CTestContainers::sequenceBasics()
     {
         CSequence<int> s1;